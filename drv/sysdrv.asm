@@ -0,0 +1,514 @@
+;-----------------------------------------------------------------------------+
+;                                                                              |
+; filename: sysdrv.asm                                                         |
+; project:  ZX Spectrum Next - SYSINFO                                         |
+; author:   Stefan Zell                                                        |
+; date:     10/19/2026                                                         |
+;                                                                              |
+;------------------------------------------------------------------------------+
+;                                                                              |
+; description:                                                                 |
+;                                                                              |
+; Read and show system information of the ZX Spectrum Next (dot command)       |
+;                                                                              |
+;------------------------------------------------------------------------------+
+;                                                                              |
+; Copyright (c) 10/19/2026 STZ Engineering                                     |
+;                                                                              |
+; This software is provided  "as is",  without warranty of any kind, express   |
+; or implied. In no event shall STZ or its contributors be held liable for any |
+; direct, indirect, incidental, special or consequential damages arising out   |
+; of the use of or inability to use this software.                             |
+;                                                                              |
+; Permission is granted to anyone  to use this  software for any purpose,      |
+; including commercial applications,  and to alter it and redistribute it      |
+; freely, subject to the following restrictions:                               |
+;                                                                              |
+; 1. Redistributions of source code must retain the above copyright            |
+;    notice, definition, disclaimer, and this list of conditions.              |
+;                                                                              |
+; 2. Redistributions in binary form must reproduce the above copyright         |
+;    notice, definition, disclaimer, and this list of conditions in            |
+;    documentation and/or other materials provided with the distribution.      |
+;                                                                          ;-) |
+;-----------------------------------------------------------------------------+
+
+;==============================================================================
+; Resident NextOS driver "sysinfo.drv"
+;
+; The driver holds a small table of static system information (machine ID,
+; board ID, core version, RAM size, drives, DOS version). The table is filled
+; once by ".sysinfo -s" and can be read afterwards by every program with
+; M_DRVAPI (C = driver ID, B = call ID) in constant time. Field 6 holds the
+; page of the capture history (".sysinfo -k").
+;
+; The IM1 routine takes background captures (".sysinfo -B n") into the page of
+; field 7 every n frames (field 8). The layout of the records is described by
+; the header of the page, which is written by the dot command. Fields 9 and 10
+; hold the offset of the next record and the number of records.
+;
+; Call 4 takes a freeze-frame snapshot (all nregs of the list in the page,
+; the block of system variables, PC and SP of the interrupted program) into
+; the page of field 11 (".sysinfo -n"). It is meant to be called by an NMI
+; handler with DE = PC and HL = SP; DE = 0 reads PC from NR $C2/$C3, where
+; the stackless NMI mode (NR $C0 bit 3) leaves the return address. The
+; selected nreg (port $243B) of the interrupted program is kept.
+;
+; Call 5 appends a record (PC, NR $DA cause, NR $D9 value, FRAMES) of an I/O
+; trap to the page of field 12 (".sysinfo -o"). It is meant to be called by
+; the NMI handler of the trap with DE = PC (0 = NR $C2/$C3). The driver
+; doesn't hook the NMI itself: the program that installs the NMI handler
+; arms the traps (NR $D8 bit 0).
+;
+; Install:  .install sysinfo.drv
+; Remove:   .uninstall sysinfo.drv
+;
+; BASIC:    DRIVER 115,1,4 TO x,drives   (BC -> x, DE -> drives)
+;==============================================================================
+
+SYSDRV_ID         equ   $73             ; must match "inc/sysDrv.h"
+SYSDRV_VERSION    equ   $0100           ; 1.00
+SYSDRV_FIELD_MAX  equ   13              ; number of cached fields
+
+FIELD_BGPAGE      equ   7               ; page of the background log
+FIELD_BGRATE      equ   8               ; frames between two records (0 = off)
+FIELD_BGNEXT      equ   9               ; offset of the next record in the page
+FIELD_BGCOUNT     equ   10              ; number of records written
+FIELD_SNAPPAGE    equ   11              ; page of the snapshot
+FIELD_TRAPPAGE    equ   12              ; page of the I/O trap log
+
+BG_REGCOUNT       equ   $05             ; offsets in the header of the page
+BG_VARADDR        equ   $06
+BG_VARSIZE        equ   $08
+BG_LIMIT          equ   $0A
+BG_REGS           equ   $10
+BG_FIRST          equ   $0020           ; offset of the first record
+
+SN_REGCOUNT       equ   $05             ; offsets in the snapshot page
+SN_VALID          equ   $06
+SN_PC             equ   $10
+SN_SP             equ   $12
+SN_FRAMES         equ   $14
+SN_LIST           equ   $20
+SN_REGS           equ   $C0             ; $0C0 - $15F
+SN_VARS           equ   $60             ; $160 - $315 (MSB + 1)
+SN_VARADDR        equ   $5B00           ; must match "inc/capture.h"
+SN_VARSIZE        equ   $01B6
+
+TR_NEXT           equ   $06             ; offsets in the I/O trap page
+TR_END            equ   $20             ; MSB of the end of the page
+
+CALL_STATUS       equ   $00
+CALL_GET          equ   $01
+CALL_SET          equ   $02
+CALL_CLEAR        equ   $03
+CALL_SNAP         equ   $04
+CALL_TRAP         equ   $05
+
+;------------------------------------------------------------------------------
+; .DRV file header
+;------------------------------------------------------------------------------
+                  defm  "NDRV"
+                  defb  SYSDRV_ID | $80 ; bit 7: call IM1 routine every frame
+                  defb  (reloc_end - reloc_start) / 2
+                  defb  0               ; additional divMMC 8K banks
+                  defb  0               ; additional ZX 8K banks
+
+;------------------------------------------------------------------------------
+; Driver code (512 bytes, assembled relative to "drv_start")
+;------------------------------------------------------------------------------
+drv_start:
+
+; $0000: Entry point of all API calls
+api_entry:        jr    api_dispatch
+                  nop
+
+; $0003: Entry point of the IM1 handler
+reloc_5:
+im1_entry:        jp    im1_handler - drv_start
+
+api_dispatch:     ld    a, b            ; CALL_STATUS ... CALL_TRAP
+                  or    a
+                  jr    z, api_status
+                  dec   a
+                  jr    z, api_get
+                  dec   a
+                  jr    z, api_set
+                  dec   a
+                  jr    z, api_clear
+                  dec   a
+                  jr    z, api_snap
+                  dec   a
+reloc_30:         jp    z, api_trap - drv_start
+
+api_error:        xor   a               ; unknown call or invalid field
+                  scf
+                  ret
+
+; B = 0: Status -> BC = version, DE = number of fields
+api_status:       ld    bc, SYSDRV_VERSION
+                  ld    de, SYSDRV_FIELD_MAX
+                  ret                   ; Carry is clear ("or a")
+
+; B = 1: Read field E -> DE = value
+api_get:
+reloc_1:          call  field_addr - drv_start
+                  ret   c
+                  ld    a, (hl)         ; valid ?
+                  or    a
+                  jr    z, api_error
+                  inc   hl
+                  ld    e, (hl)
+                  inc   hl
+                  ld    d, (hl)
+                  ret                   ; Carry is clear ("or a")
+
+; B = 2: Write HL to field E
+api_set:          push  hl
+reloc_2:          call  field_addr - drv_start
+                  pop   de
+                  ret   c
+                  ld    (hl), 1         ; valid
+                  inc   hl
+                  ld    (hl), e
+                  inc   hl
+                  ld    (hl), d
+                  ret                   ; Carry is clear ("field_addr")
+
+; B = 3: Invalidate all fields
+api_clear:
+reloc_3:          ld    hl, fields - drv_start
+                  ld    b, SYSDRV_FIELD_MAX * 3
+                  xor   a
+api_clear_loop:   ld    (hl), a
+                  inc   hl
+                  djnz  api_clear_loop
+                  ret                   ; Carry is clear ("xor a")
+
+; HL = address of field E (3 bytes: valid, value LSB, value MSB)
+; Carry set if E is out of range
+field_addr:       ld    a, e
+                  cp    SYSDRV_FIELD_MAX
+                  ccf
+                  ret   c
+                  ld    l, a
+                  add   a, a
+                  add   a, l
+reloc_4:          ld    hl, fields - drv_start
+                  add   hl, a
+                  and   a
+                  ret
+
+;------------------------------------------------------------------------------
+; B = 4: Snapshot (DE = PC, HL = SP of the interrupted program)
+;------------------------------------------------------------------------------
+api_snap:         push  ix
+                  push  hl
+                  push  de
+reloc_13:         ld    a, (fields + (FIELD_SNAPPAGE * 3) + 1 - drv_start)
+reloc_14:         call  map_page - drv_start
+                  jr    c, snap_exit
+                  push  de              ; MMU slot
+                  push  af              ; selected nreg
+
+                  ld    hl, 4           ; PC and SP from the stack
+                  add   hl, sp
+                  ld    d, ixh
+                  ld    e, SN_PC
+                  ld    bc, 4
+                  ldir                  ; DE = SN_FRAMES
+
+                  ld    a, (ix + SN_PC)
+                  or    (ix + SN_PC + 1)
+                  jr    nz, snap_frames
+reloc_15:         call  read_retadr - drv_start
+                  ld    (ix + SN_PC), l
+                  ld    (ix + SN_PC + 1), h
+
+reloc_31:
+snap_frames:      call  copy_frames - drv_start
+
+                  ld    a, (ix + SN_REGCOUNT)
+                  ld    d, ixh          ; DE = list, HL = values
+                  ld    e, SN_LIST
+                  ld    h, d
+                  ld    l, SN_REGS
+reloc_16:         call  read_regs - drv_start
+
+                  ld    hl, SN_VARADDR
+                  ld    d, ixh
+                  inc   d
+                  ld    e, SN_VARS
+                  ld    bc, SN_VARSIZE
+                  ldir
+                  ld    (ix + SN_VALID), 1
+
+                  pop   af              ; Carry is clear ("map_page")
+                  pop   de
+reloc_17:         call  unmap_page - drv_start
+
+snap_exit:        pop   de
+                  pop   hl
+                  pop   ix
+                  ret
+
+;------------------------------------------------------------------------------
+; B = 5: Record an I/O trap (DE = PC of the interrupted program)
+;
+; Records are 8 bytes (PC, cause, value, FRAMES, reserved); the log stops at
+; the end of the page.
+;------------------------------------------------------------------------------
+api_trap:         push  ix
+                  push  de
+reloc_24:         ld    a, (fields + (FIELD_TRAPPAGE * 3) + 1 - drv_start)
+reloc_25:         call  map_page - drv_start
+                  pop   hl              ; PC
+                  jr    c, trap_exit
+                  push  de              ; MMU slot
+                  push  af              ; selected nreg
+
+                  ld    a, h
+                  or    l
+                  jr    nz, trap_record
+reloc_26:         call  read_retadr - drv_start
+
+trap_record:      ld    e, (ix + TR_NEXT)
+                  ld    d, (ix + TR_NEXT + 1)
+                  ld    a, d
+                  cp    TR_END
+                  jr    nc, trap_unmap  ; page is full
+                  add   a, ixh
+                  ld    d, a
+                  ex    de, hl          ; HL = record, DE = PC
+                  ld    (hl), e
+                  inc   hl
+                  ld    (hl), d
+                  inc   hl
+                  ld    a, $DA          ; IOTRAPCAUSE
+reloc_27:         call  read_nreg - drv_start
+                  ld    (hl), a
+                  inc   hl
+                  ld    a, $D9          ; IOTRAPSWR
+reloc_28:         call  read_nreg - drv_start
+                  ld    (hl), a
+                  inc   hl
+                  ex    de, hl
+reloc_32:         call  copy_frames - drv_start
+                  inc   de
+                  ld    a, d
+                  sub   ixh
+                  ld    (ix + TR_NEXT + 1), a
+                  ld    (ix + TR_NEXT), e
+
+trap_unmap:       pop   af              ; Carry is clear ("map_page")
+                  pop   de
+reloc_29:         call  unmap_page - drv_start
+
+trap_exit:        pop   ix
+                  ret
+
+;------------------------------------------------------------------------------
+; Helpers
+;------------------------------------------------------------------------------
+
+; Map page A into MMU slot 6 (slot 7 if the stack is in slot 6), so FRAMES
+; and the system variables in slot 2 stay visible
+; -> IX = address of the page, D = MMU nreg, E = previous page of the slot,
+;    A = selected nreg (port $243B) of the interrupted program
+;    Carry set (A = 0) if there is no page
+map_page:         or    a
+                  scf
+                  ret   z
+                  ld    e, a
+                  ld    hl, 0
+                  add   hl, sp
+                  ld    a, h
+                  and   $E0
+                  cp    $C0
+                  ld    l, e
+                  ld    de, $56C0
+                  jr    nz, map_page_slot
+                  ld    de, $57E0
+map_page_slot:    ld    ixh, e
+                  ld    ixl, 0
+                  ld    bc, $243B
+                  in    h, (c)
+                  out   (c), d
+                  inc   b
+                  in    e, (c)
+                  out   (c), l
+                  ld    a, h
+                  and   a
+                  ret
+
+; Restore the MMU slot (D = MMU nreg, E = previous page) and the selected
+; nreg (A)
+unmap_page:       ld    bc, $243B
+                  out   (c), d
+                  inc   b
+                  out   (c), e
+                  dec   b
+                  out   (c), a
+                  ret
+
+; Copy FRAMES to DE
+copy_frames:      ld    hl, $5C78
+                  ld    bc, 3
+                  ldir
+                  ret
+
+; A = value of nreg A
+read_nreg:        ld    bc, $243B
+                  out   (c), a
+                  inc   b
+                  in    a, (c)
+                  ret
+
+; Copy the values of A nregs (numbers at DE) to HL
+read_regs:        or    a
+                  ret   z
+read_regs_loop:   push  af
+                  ld    a, (de)
+                  inc   de
+reloc_18:         call  read_nreg - drv_start
+                  ld    (hl), a
+                  inc   hl
+                  pop   af
+                  dec   a
+                  jr    nz, read_regs_loop
+                  ret
+
+; HL = return address of the NMI (NR $C2/$C3, stackless NMI mode)
+read_retadr:      ld    a, $C2
+reloc_19:         call  read_nreg - drv_start
+                  ld    l, a
+                  ld    a, $C3
+reloc_20:         call  read_nreg - drv_start
+                  ld    h, a
+                  ret
+
+;------------------------------------------------------------------------------
+; IM1: Append a record (FRAMES, nregs, sysvars) to the background log
+;
+; The page is mapped into MMU slot 6 for a moment (slot 7 if the stack of the
+; interrupted program is in slot 6). The selected nreg (port $243B) of the
+; interrupted program is restored.
+;------------------------------------------------------------------------------
+im1_handler:      push  af
+                  push  bc
+                  push  de
+                  push  hl
+                  push  ix
+
+reloc_6:          ld    a, (fields + (FIELD_BGRATE * 3) + 1 - drv_start)
+                  or    a               ; rate (0 = off or not set)
+                  jr    z, im1_exit
+reloc_7:          ld    hl, bg_countdown - drv_start
+                  dec   (hl)
+                  jr    nz, im1_exit
+                  ld    (hl), a         ; restart countdown
+
+reloc_8:          ld    a, (fields + (FIELD_BGPAGE * 3) + 1 - drv_start)
+reloc_21:         call  map_page - drv_start
+                  jr    c, im1_exit
+                  push  de              ; MMU slot
+                  push  af              ; selected nreg
+
+reloc_9:          ld    hl, (fields + (FIELD_BGNEXT * 3) + 1 - drv_start)
+                  ld    a, h
+                  add   a, ixh
+                  ld    d, a
+                  ld    e, l            ; DE = next record
+reloc_33:         call  copy_frames - drv_start
+                  ex    de, hl
+
+                  ld    a, (ix + BG_REGCOUNT)
+                  ld    d, ixh          ; DE = list of nregs
+                  ld    e, BG_REGS
+reloc_22:         call  read_regs - drv_start
+
+                  ld    c, (ix + BG_VARSIZE)
+                  ld    b, 0
+                  ld    a, c
+                  or    a
+                  jr    z, im1_next
+                  ld    e, (ix + BG_VARADDR)
+                  ld    d, (ix + BG_VARADDR + 1)
+                  ex    de, hl
+                  ldir
+                  ex    de, hl
+
+im1_next:         ld    a, h            ; HL = offset of the next record
+                  sub   ixh
+                  ld    h, a
+                  ld    e, (ix + BG_LIMIT)
+                  ld    d, (ix + BG_LIMIT + 1)
+                  push  hl
+                  and   a
+                  sbc   hl, de
+                  pop   hl
+                  jr    c, im1_store
+                  ld    hl, BG_FIRST    ; wrap around
+reloc_10:
+im1_store:        ld    (fields + (FIELD_BGNEXT * 3) + 1 - drv_start), hl
+reloc_11:         ld    hl, (fields + (FIELD_BGCOUNT * 3) + 1 - drv_start)
+                  inc   hl
+                  ld    a, h
+                  or    l
+                  jr    z, im1_unmap    ; saturate at 65535
+reloc_12:         ld    (fields + (FIELD_BGCOUNT * 3) + 1 - drv_start), hl
+
+im1_unmap:        pop   af
+                  pop   de
+reloc_23:         call  unmap_page - drv_start
+
+im1_exit:         pop   ix
+                  pop   hl
+                  pop   de
+                  pop   bc
+                  pop   af
+                  ret
+
+bg_countdown:     defb  1
+
+fields:           defs  SYSDRV_FIELD_MAX * 3, 0
+
+drv_end:          defs  512 - (drv_end - drv_start), 0
+
+;------------------------------------------------------------------------------
+; Relocation table (offsets of all high bytes of absolute addresses)
+;------------------------------------------------------------------------------
+reloc_start:      defw  reloc_1 + 2 - drv_start
+                  defw  reloc_2 + 2 - drv_start
+                  defw  reloc_3 + 2 - drv_start
+                  defw  reloc_4 + 2 - drv_start
+                  defw  reloc_5 + 2 - drv_start
+                  defw  reloc_6 + 2 - drv_start
+                  defw  reloc_7 + 2 - drv_start
+                  defw  reloc_8 + 2 - drv_start
+                  defw  reloc_9 + 2 - drv_start
+                  defw  reloc_10 + 2 - drv_start
+                  defw  reloc_11 + 2 - drv_start
+                  defw  reloc_12 + 2 - drv_start
+                  defw  reloc_13 + 2 - drv_start
+                  defw  reloc_14 + 2 - drv_start
+                  defw  reloc_15 + 2 - drv_start
+                  defw  reloc_16 + 2 - drv_start
+                  defw  reloc_17 + 2 - drv_start
+                  defw  reloc_18 + 2 - drv_start
+                  defw  reloc_19 + 2 - drv_start
+                  defw  reloc_20 + 2 - drv_start
+                  defw  reloc_21 + 2 - drv_start
+                  defw  reloc_22 + 2 - drv_start
+                  defw  reloc_23 + 2 - drv_start
+                  defw  reloc_24 + 2 - drv_start
+                  defw  reloc_25 + 2 - drv_start
+                  defw  reloc_26 + 2 - drv_start
+                  defw  reloc_27 + 2 - drv_start
+                  defw  reloc_28 + 2 - drv_start
+                  defw  reloc_29 + 2 - drv_start
+                  defw  reloc_30 + 2 - drv_start
+                  defw  reloc_31 + 2 - drv_start
+                  defw  reloc_32 + 2 - drv_start
+                  defw  reloc_33 + 2 - drv_start
+reloc_end:
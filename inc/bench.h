@@ -0,0 +1,218 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: bench.h                                                            |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__BENCH_H__)
+  #define __BENCH_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Default length of a measurement in frames
+*/
+#define BENCH_FRAMES (5)
+
+/*!
+Number of CPU speeds (0 = 3.5 MHz ... 3 = 28 MHz)
+*/
+#define BENCH_SPEEDS (4)
+
+/*!
+Stopwatch: CTC channels 3 - 5 (prescaler 256, 24 bit), one tick = 256 cycles
+of the 28 MHz clock (64/7 us)
+*/
+#define BENCH_WATCH_CTC(n) (0x1B3B + ((n) << 8))
+#define BENCH_WATCH_US(t)  ((((uint32_t) (t)) * 64) / 7)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Names of the CPU speeds (MHz; RTM_3MHZ - RTM_28MHZ)
+*/
+extern const char_t* g_acSpeedNames[BENCH_SPEEDS];
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Function under test. A single call must take less than one frame.
+*/
+typedef void (*benchfn_t)(void);
+
+/*!
+Timing of a display timing (NR 0x03 bits 6:4) at 50/60 Hz
+*/
+typedef struct _benchdisplay
+{
+  const char_t* acName;
+  uint8_t       uiLineT;                   /* T-states per line (3.5 MHz)     */
+  uint16_t      auiLines[2];               /* lines per frame at 50/60 Hz     */
+} benchdisplay_t;
+
+/*!
+Video timing (NR 0x11 bits 2:0) and its master clock
+*/
+typedef struct _benchtiming
+{
+  const char_t* acName;
+  uint16_t      uiMaster;                  /* kHz                             */
+} benchtiming_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Call a function as often as possible within a number of frames. The frames
+are counted by the scanline (NR 0x1E/0x1F), so the caller has to disable the
+interrupts (e.g. by mapping a page).
+@param pFn      Function under test
+@param uiFrames Length of the measurement in frames
+@return Number of calls
+*/
+uint32_t benchRun(benchfn_t pFn, uint8_t uiFrames);
+
+/*!
+Measure the T-states of a single call of a function at the current CPU speed.
+The length of the window is taken from the display timing ("benchFrameCycles")
+plus the lines after the end of the last frame, so the result isn't quantized
+to whole calls. The time of the measuring loop itself is subtracted.
+Interrupts have to be disabled (see "benchRun").
+@param pFn      Function under test
+@param uiFrames Length of the measurement in frames
+@return T-states per call (nominal clock)
+*/
+uint32_t benchCycles(benchfn_t pFn, uint8_t uiFrames);
+
+/*!
+Nominal clock of the CPU at the current speed (NR 0x07)
+@return Clock in kHz
+*/
+uint16_t benchClock(void);
+
+/*!
+Refresh rate of the video output (NR 0x05)
+@return 50 or 60 Hz
+*/
+uint8_t benchFrameRate(void);
+
+/*!
+Display timing (NR 0x03 bits 6:4)
+@return Timing; 0 T-states per line = "unknown"
+*/
+const benchdisplay_t* benchDisplay(void);
+
+/*!
+Video timing (NR 0x11 bits 2:0)
+@return Timing and its master clock
+*/
+const benchtiming_t* benchTiming(void);
+
+/*!
+T-states of a frame at the current CPU speed (e.g. 69888 T for 48K at
+3.5 MHz). Unknown display timings use the nominal clock / refresh rate.
+@return T-states per frame (nominal clock)
+*/
+uint32_t benchFrameCycles(void);
+
+/*!
+Set the CPU speed for a measurement. The speed of the application is
+restored by "benchSpeed(RTM_28MHZ)".
+@param uiSpeed 0 = 3.5 MHz ... 3 = 28 MHz
+*/
+void benchSpeed(uint8_t uiSpeed);
+
+/*!
+Start the stopwatch. It runs independent of the CPU speed and the interrupts,
+so it can measure calls of the OS (up to about 150 seconds).
+*/
+void benchWatchStart(void);
+
+/*!
+Read the stopwatch
+@return Ticks since "benchWatchStart" (see BENCH_WATCH_US)
+*/
+uint32_t benchWatchRead(void);
+
+/*!
+Stop the stopwatch (reset of the CTC channels)
+*/
+void benchWatchStop(void);
+
+/*!
+Sort samples in ascending order (insertion sort; few samples)
+@param pValues Samples
+@param uiCount Number of samples
+*/
+void benchSort(uint16_t* pValues, uint8_t uiCount);
+
+/*!
+Percentile of sorted samples
+@param pSorted   Samples (see "benchSort")
+@param uiCount   Number of samples
+@param uiPercent Percentile (0 = minimum, 100 = maximum)
+@return Sample
+*/
+uint16_t benchPercentile(const uint16_t* pSorted, uint8_t uiCount, uint8_t uiPercent);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __BENCH_H__ */
@@ -0,0 +1,107 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchCont.h                                                        |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__BENCHCONT_H__)
+  #define __BENCHCONT_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+First and last MMU slot of the matrix (slot 0/1 = ROM/divMMC are left out)
+*/
+#define BENCHCONT_FIRST (2)
+#define BENCHCONT_LAST  (7)
+
+/*!
+Iterations of the test loop (4 data accesses each, see "benchContLoop")
+*/
+#define BENCHCONT_ITER  (16)
+
+/*!
+Offset of the data accessed within the slot
+*/
+#define BENCHCONT_OFFSET (0x1000)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Measure the cost of memory accesses for each kind of page in each 8K MMU
+slot at all CPU speeds. The result is a matrix of the additional T-states
+per access (contention and wait states) compared to an allocated page in
+the first free slot. Slots that hold the stack or the code of the
+measurement are skipped.
+@return EOK = "no error"
+*/
+int dumpContentionBench(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __BENCHCONT_H__ */
@@ -0,0 +1,121 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchLat.h                                                         |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__BENCHLAT_H__)
+  #define __BENCHLAT_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Samples of each run: the first ones are taken with an idle CPU to calibrate
+the period of the interrupt, the others under load.
+*/
+#define BENCHLAT_CALIB   (8)
+#define BENCHLAT_SAMPLES (32)
+#define BENCHLAT_TOTAL   (BENCHLAT_CALIB + BENCHLAT_SAMPLES)
+
+/*!
+Maximum length of a run in frames
+*/
+#define BENCHLAT_TIMEOUT (100)
+
+/*!
+Scanline of the line interrupt (NR 0x23)
+*/
+#define BENCHLAT_LINE    (100)
+
+/*!
+Time constant of the CTC interrupt (channel 0, prescaler 16)
+*/
+#define BENCHLAT_CTCTC   (200)
+
+/*!
+T-states of the IM2 acknowledge (best case latency) and from the entry of the
+handler (vector) to the time stamp
+*/
+#define BENCHLAT_ACKT    (19)
+#define BENCHLAT_ENTRYT  (106)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Measure the latency from the assertion of an interrupt (ULA, line, CTC) to
+the entry of the IM2 handler, with legacy and hardware IM2 mode (NR 0xC0),
+while the CPU is idle, executes LDIR or is halted by the zxnDMA. The CTC
+(28 MHz, prescaler 16) is used as time base; the results are shown as
+minimum, median, 95th percentile and maximum in T-states (28 MHz).
+@return EOK = "no error"
+*/
+int dumpLatencyBench(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __BENCHLAT_H__ */
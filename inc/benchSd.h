@@ -0,0 +1,122 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchSd.h                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__BENCHSD_H__)
+  #define __BENCHSD_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Name of the scratch file (deleted after the benchmark)
+*/
+#define BENCHSD_FILE  "SYSINFO.TMP"
+
+/*!
+Size of the scratch file and maximum number of blocks per block size
+*/
+#define BENCHSD_TOTAL (32768)
+#define BENCHSD_COUNT (256)
+
+/*!
+Maximum number of fragments of the scratch file for sector streaming
+*/
+#define BENCHSD_MAPS  (8)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Fragment of a file on the card (NextZXOS DISK_FILEMAP)
+*/
+typedef struct _benchsdmap
+{
+  uint32_t uiAddress;                      /* card address (byte/block)       */
+  uint16_t uiSectors;                      /* number of 512 byte sectors      */
+} benchsdmap_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Write and read a scratch file with block sizes from 1 byte to 8 KB using
+esx_f_write/esx_f_read, then read it by the sector streaming of NextZXOS
+(DISK_FILEMAP, DISK_STRMSTART, DISK_STRMEND). The throughput is shown in
+KB/s; the scratch file is deleted afterwards.
+@param cDrive Drive of the scratch file ('\0' = current drive)
+@return EOK = "no error"
+*/
+int dumpSdBench(char_t cDrive);
+
+/*!
+Build the pathname of the scratch file on a drive
+@param acPath Buffer for the pathname (at least 16 characters)
+@param cDrive Drive ('\0' = current drive)
+*/
+void benchSdPath(char_t* acPath, char_t cDrive);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __BENCHSD_H__ */
@@ -0,0 +1,146 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: bglog.h                                                            |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__BGLOG_H__)
+  #define __BGLOG_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Identification of a background log (page and file)
+*/
+#define BGLOG_MAGIC    "SYSB"
+
+/*!
+Version of the layout of the background log
+*/
+#define BGLOG_VERSION  (0x01)
+
+/*!
+Maximum number of nregs per record
+*/
+#define BGLOG_REGS_MAX (16)
+
+/*!
+Maximum number of bytes of system variables per record
+*/
+#define BGLOG_VARS_MAX (32)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Header of the background log at the start of the page and of the file. The
+IM1 routine of the driver reads the layout of the records from here, so the
+offsets must match "drv/sysdrv.asm". Each record holds FRAMES (3 bytes), the
+values of the nregs and a copy of the system variables.
+*/
+typedef struct _bgloghdr
+{
+  char_t   acMagic[4];                 /* 0x00: BGLOG_MAGIC                  */
+  uint8_t  uiVersion;                  /* 0x04: BGLOG_VERSION                */
+  uint8_t  uiRegCount;                 /* 0x05: number of nregs              */
+  uint16_t uiVarAddr;                  /* 0x06: address of system variables  */
+  uint8_t  uiVarSize;                  /* 0x08: number of bytes of sysvars   */
+  uint8_t  uiRecSize;                  /* 0x09: size of a record             */
+  uint16_t uiLimit;                    /* 0x0A: end of the last record slot  */
+  uint16_t uiCount;                    /* 0x0C: number of records (file)     */
+  uint16_t uiFirst;                    /* 0x0E: offset of the first record   */
+  uint8_t  auiRegs[BGLOG_REGS_MAX];    /* 0x10: list of nregs                */
+} bgloghdr_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Start or stop the background log of the resident driver.
+@code
+n[:regs[:addr,len]]  e.g. "5:50,51,52:5B5C,1"
+n         frames between two records (0 = stop and release the page)
+regs      hexadecimal numbers of the nregs (default: MMU, layers, palette)
+addr,len  hexadecimal address and number of bytes of system variables
+@endcode
+@param acArg Argument of the option "-B"
+@return EOK = "no error"
+*/
+int bglogStart(const char_t* acArg);
+
+/*!
+Check if a background log exists (driver installed and page reserved)
+@return "true" = background log exists
+*/
+bool bglogActive(void);
+
+/*!
+Write all records of the background log (oldest first) with the header to the
+dump file. Afterwards the log is empty.
+@return EOK = "no error"
+*/
+int bglogFlush(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __BGLOG_H__ */
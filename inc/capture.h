@@ -0,0 +1,174 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: capture.h                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__CAPTURE_H__)
+  #define __CAPTURE_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Start address of the block of system variables that is captured
+*/
+#define CAPTURE_VARS_ADDR (0x5B00)
+
+/*!
+Size of the block of system variables that is captured (0x5B00 - 0x5CB5)
+*/
+#define CAPTURE_VARS_SIZE (0x5CB6 - CAPTURE_VARS_ADDR)
+
+/*!
+Maximum number of nregs in a capture (must be >= entries of "g_tRegisters")
+*/
+#define CAPTURE_REGS_MAX  (0xA0)
+
+/*!
+Number of clip windows (NR 0x18 - 0x1B)
+*/
+#define CAPTURE_CLIP_MAX  (4)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Raw capture of all nregs and system variables. The values of the nregs are
+stored in the order of "g_tRegisters" and the system variables as plain copy
+of the memory block at "CAPTURE_VARS_ADDR".
+*/
+typedef struct _capture
+{
+  /*!
+  Value of the system variable FRAMES (0x5C78) at the time of the capture
+  */
+  uint8_t auiFrames[3];
+
+  /*!
+  Number of valid entries in "auiRegs"
+  */
+  uint8_t uiRegCount;
+
+  /*!
+  Date of the capture (MSDOS format, 0 = unknown)
+  */
+  uint16_t uiDosDate;
+
+  /*!
+  Time of the capture (MSDOS format)
+  */
+  uint16_t uiDosTime;
+
+  /*!
+  Values of all nregs
+  */
+  uint8_t auiRegs[CAPTURE_REGS_MAX];
+
+  /*!
+  Copy of the block of system variables
+  */
+  uint8_t auiVars[CAPTURE_VARS_SIZE];
+
+  /*!
+  All coordinates (X1, X2, Y1, Y2) of the clip windows of layer 2, sprites,
+  ULA and tilemap. The nregs only show the coordinate of the current index.
+  */
+  uint8_t auiClip[CAPTURE_CLIP_MAX][4];
+} capture_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Read all nregs and the block of system variables into a raw capture. No
+decoding and no output is done here, so this is fast enough to be called
+every frame.
+@param pCapture Buffer to store the capture
+*/
+void captureTake(capture_t* pCapture);
+
+/*!
+Stamp a capture with the current date and time of the RTC (if available)
+@param pCapture Capture to stamp
+*/
+void captureStamp(capture_t* pCapture);
+
+/*!
+Get the value of the system variable FRAMES of a capture as integer
+@param pCapture Capture
+@return Number of frames
+*/
+uint32_t captureFrames(const capture_t* pCapture);
+
+/*!
+Count the number of nregs and bytes of system variables that differ between
+two captures.
+@param pOld Older capture
+@param pNew Newer capture
+@return Number of changed values
+*/
+uint16_t captureChanges(const capture_t* pOld, const capture_t* pNew);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __CAPTURE_H__ */
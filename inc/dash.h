@@ -0,0 +1,126 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dash.h                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__DASH_H__)
+  #define __DASH_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Source of a cell: value of a nreg (0x00 - 0xFF)
+*/
+#define DASH_SRC_NREG   (0x0000)
+
+/*!
+Source of a cell: system variable FRAMES
+*/
+#define DASH_SRC_FRAMES (0x0100)
+
+/*!
+Source of a cell: number of free 8K pages
+*/
+#define DASH_SRC_FREE   (0x0200)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Structure of a cell of the dashboard
+*/
+typedef struct _dashcell
+{
+  /*!
+  Screen position of the label
+  */
+  const uint8_t uiRow;
+  const uint8_t uiCol;
+
+  /*!
+  Source of the value (DASH_SRC_... | number of the nreg)
+  */
+  const uint16_t uiSource;
+
+  /*!
+  Label in front of the value
+  */
+  const char_t* acLabel;
+} dashcell_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Show a full-screen dashboard with a fixed grid of key values that is updated
+every "uiFrames" frames until BREAK is pressed. Only cells whose raw value has
+changed are redrawn.
+@param uiFrames Number of frames between two updates (0/1 = 50 Hz)
+@return EOK = "no error"
+*/
+int dashShow(uint8_t uiFrames);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __DASH_H__ */
@@ -75,6 +75,13 @@ Output all information about the operating system of the Next
 */
 int dumpOperatingSystem(void);
 
+/*!
+Detect all drives that are available in the system. This is expensive, because
+every drive letter is selected once.
+@return Bitmask of available drives (bit 0 = 'A' ... bit 15 = 'P')
+*/
+uint16_t getAvailableDrives(void);
+
 /*============================================================================*/
 /*                               Klassen                                      */
 /*============================================================================*/
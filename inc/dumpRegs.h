@@ -58,6 +58,12 @@ Formatstring to specify output of nreg subtopics
 */
 #define DUMP_REGSUB  "%-11s"
 
+/*!
+Minimum number of screen columns for the labelled matrix ("-c"); on smaller
+screens the 16 values of a row are printed without separators
+*/
+#define DUMP_MATRIX_WIDE (51)
+
 /*============================================================================*/
 /*                               Namespaces                                   */
 /*============================================================================*/
@@ -98,6 +104,11 @@ typedef struct _regentry
   const char_t* acName;
 } regentry_t;
 
+/*!
+List of all NEXT registers that will be dumped (terminated by "acName == 0")
+*/
+extern const regentry_t g_tRegisters[];
+
 /*============================================================================*/
 /*                               Prototypen                                   */
 /*============================================================================*/
@@ -107,6 +118,21 @@ Output all information about registers of the Next
 */
 int dumpRegisters(void);
 
+/*!
+Output the raw values of all nregs as 16x16 hex matrix (row = high nibble,
+column = low nibble); nregs that are not listed are left blank
+@return EOK = "no error"
+*/
+int dumpRegisterMatrix(void);
+
+/*!
+Output all sub-fields of a single nreg (without the line of the nreg itself)
+@param uiRegNum Number of the nreg to decode
+@param uiValue  Value of the nreg
+@return EOK = "no error"
+*/
+int dumpRegisterValue(uint8_t uiRegNum, uint8_t uiValue);
+
 /*============================================================================*/
 /*                               Klassen                                      */
 /*============================================================================*/
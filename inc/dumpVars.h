@@ -95,6 +95,11 @@ typedef struct _varentry
   const char_t* acName;
 } varentry_t;
 
+/*!
+List of all system variables that will be dumped (terminated by "acName == 0")
+*/
+extern const varentry_t g_tVariables[];
+
 /*============================================================================*/
 /*                               Prototypen                                   */
 /*============================================================================*/
@@ -103,6 +108,14 @@ Output all information about system variables of the Next
 */
 int dumpVariables(void);
 
+/*!
+Output a single system variable with all sub-fields
+@param pVar Description of the system variable
+@param pRaw Raw bytes of the variable (memory or capture)
+@return EOK = "no error"
+*/
+int dumpVariable(const varentry_t* pVar, const uint8_t* pRaw);
+
 /*============================================================================*/
 /*                               Klassen                                      */
 /*============================================================================*/
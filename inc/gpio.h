@@ -0,0 +1,125 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: gpio.h                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__GPIO_H__)
+  #define __GPIO_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Default length of a capture in frames (option "-L")
+*/
+#define GPIO_FRAMES    (50)
+
+/*!
+Number of Pi GPIO input registers (NR 0x98 - 0x9B)
+*/
+#define GPIO_REGS      (4)
+
+/*!
+Number of Pi GPIO pins (GPIO 0 - 27)
+*/
+#define GPIO_PINS      (28)
+
+/*!
+Max. number of pages for the samples
+*/
+#define GPIO_PAGES_MAX (4)
+
+/*!
+Max. number of samples of a capture (24 bit counter)
+*/
+#define GPIO_TICK_MAX  (0x00FFFFFFUL)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Record of a change of the GPIO inputs. The first record of a capture holds the
+initial state.
+*/
+typedef struct _gpiorec
+{
+  uint8_t auiTick[3];                      /* number of the sample            */
+  uint8_t auiValue[GPIO_REGS];             /* NR 0x98 - 0x9B                  */
+  uint8_t uiReserved;
+} gpiorec_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Sample the Pi GPIO inputs with disabled interrupts as fast as possible and
+store all changes in reserved pages. Afterwards the changes are written as
+VCD file (value change dump) to the dump file.
+@param uiFrames Length of the capture in frames
+@return EOK = "no error"
+*/
+int gpioCapture(uint8_t uiFrames);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __GPIO_H__ */
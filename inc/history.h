@@ -0,0 +1,175 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: history.h                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__HISTORY_H__)
+  #define __HISTORY_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define DUMP_HISTNUM "%2u"
+
+/*!
+Signature at the start of the history page
+*/
+#define HIST_MAGIC   "SYSH"
+
+/*!
+Format version of the history page
+*/
+#define HIST_VERSION (0x02)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Header of the reserved page that holds the capture history. The captures are
+stored as ring buffer directly behind the header.
+*/
+typedef struct _histhdr
+{
+  /*!
+  Signature (HIST_MAGIC)
+  */
+  char_t acMagic[4];
+
+  /*!
+  Format version (HIST_VERSION)
+  */
+  uint8_t uiVersion;
+
+  /*!
+  Number of nregs per capture (changes if the list of nregs changes)
+  */
+  uint8_t uiRegCount;
+
+  /*!
+  Number of valid captures
+  */
+  uint8_t uiCount;
+
+  /*!
+  Index of the slot for the next capture
+  */
+  uint8_t uiNext;
+} histhdr_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Take a raw capture and append it to the history page. The page is allocated at
+the first call.
+@return EOK = "no error"
+*/
+int histAppend(void);
+
+/*!
+Append a given raw capture to the history page. The page is allocated at the
+first call.
+@param pCapture Capture to append
+@return EOK = "no error"
+*/
+int histStore(const capture_t* pCapture);
+
+/*!
+Show all captures in the history page with the number of changes between two
+consecutive captures.
+@return EOK = "no error"
+*/
+int histList(void);
+
+/*!
+Write all captures of the history page in one block to the dump file and
+clear the history.
+@return EOK = "no error"
+*/
+int histFlush(void);
+
+/*!
+Take a raw capture and write it as capture file with a single entry to the
+dump file.
+@return EOK = "no error"
+*/
+int histSave(void);
+
+/*!
+Load the newest capture of a binary capture file ("-b", "-x")
+@param acPathName Pathname of the file
+@param pCapture   Buffer to store the capture
+@return EOK = "no error"; ENOTSUP = "not a binary capture";
+        EINVAL = "incompatible capture"
+*/
+int histLoad(const char_t* acPathName, capture_t* pCapture);
+
+/*!
+Return the history page to NextOS
+@return EOK = "no error"
+*/
+int histRelease(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __HISTORY_H__ */
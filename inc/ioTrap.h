@@ -0,0 +1,147 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: ioTrap.h                                                           |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__IOTRAP_H__)
+  #define __IOTRAP_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define DUMP_TRAPNAME "%-9s"
+
+/*!
+Identification of the I/O trap page
+*/
+#define IOTRAP_MAGIC   "SYTR"
+
+/*!
+Version of the layout of the I/O trap page
+*/
+#define IOTRAP_VERSION (0x01)
+
+/*!
+Offset of the first record in the I/O trap page
+*/
+#define IOTRAP_FIRST   (0x0020)
+
+/*!
+Number of different caller addresses that are counted
+*/
+#define IOTRAP_PCS_MAX (32)
+
+/*!
+Number of caller addresses that are shown
+*/
+#define IOTRAP_TOP     (8)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Header of the I/O trap page. The records are appended by call 5 of the
+resident driver, so the offsets must match "drv/sysdrv.asm".
+*/
+typedef struct _iotrap
+{
+  char_t   acMagic[4];                     /* 0x00: IOTRAP_MAGIC              */
+  uint8_t  uiVersion;                      /* 0x04: IOTRAP_VERSION            */
+  uint8_t  uiReserved1;
+  uint16_t uiNext;                         /* 0x06: offset of the next record */
+  uint8_t  auiReserved2[IOTRAP_FIRST - 8];
+} iotrap_t;
+
+/*!
+Record of a single trapped port access
+*/
+typedef struct _iotraprec
+{
+  uint16_t uiPC;                           /* 0x00: PC of the program         */
+  uint8_t  uiCause;                        /* 0x02: NR 0xDA (IOTRAPCAUSE)     */
+  uint8_t  uiValue;                        /* 0x03: NR 0xD9 (IOTRAPSWR)       */
+  uint8_t  auiFrames[3];                   /* 0x04: FRAMES                    */
+  uint8_t  uiReserved;
+} iotraprec_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Show the port accesses that were recorded since the last call (histogram by
+port and by caller) and empty the log. The traps (NR 0xD8 bit 0, +3 FDC ports
+0x2FFD and 0x3FFD only) are armed by the program that installs the NMI
+handler, which calls the resident driver (call 5) for each trap.
+@return EOK = "no error"
+*/
+int ioTrapShow(void);
+
+/*!
+Disarm the I/O traps (NR 0xD8 bit 0) and release the page of the log
+@return EOK = "no error"
+*/
+int ioTrapDisarm(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __IOTRAP_H__ */
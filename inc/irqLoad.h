@@ -0,0 +1,124 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: irqLoad.h                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__IRQLOAD_H__)
+  #define __IRQLOAD_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Default length of the measurement window in seconds
+*/
+#define IRQLOAD_WINDOW (2)
+
+/*!
+Maximum length of the measurement window in seconds (counters are 16 bit)
+*/
+#define IRQLOAD_WINDOW_MAX (60)
+
+/*!
+Formatstring to specify output of interrupt sources
+*/
+#define DUMP_IRQNAME "%-11s"
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Structure of an interrupt source (bit in NR 0xC8 - 0xCA)
+*/
+typedef struct _irqsource
+{
+  /*!
+  Index of the status register (0 = NR 0xC8 ... 2 = NR 0xCA)
+  */
+  const uint8_t uiReg;
+
+  /*!
+  Bit in the status register
+  */
+  const uint8_t uiBit;
+
+  /*!
+  Name of the source
+  */
+  const char_t* acName;
+} irqsource_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Count the interrupts of each source (IRQSTATUS0 - IRQSTATUS2) over a window
+and estimate the share of the CPU time that is used by interrupt handlers.
+@param uiSeconds Length of the window in seconds (1 - IRQLOAD_WINDOW_MAX)
+@return EOK = "no error"; EINVAL = "invalid window"
+*/
+int dumpInterruptLoad(uint8_t uiSeconds);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __IRQLOAD_H__ */
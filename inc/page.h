@@ -0,0 +1,127 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: page.h                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__PAGE_H__)
+  #define __PAGE_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Size of a 8K page in bytes
+*/
+#define PAGE_SIZE     (0x2000)
+
+/*!
+Marker for "no page allocated"
+*/
+#define PAGE_INVALID  (0xFF)
+
+/*!
+MMU slot that is used to access allocated pages (slot 3 = 0x6000 - 0x7FFF)
+*/
+#define PAGE_MMU_SLOT (3)
+
+/*!
+Logical address of a mapped page
+*/
+#define PAGE_ADDRESS  ((void*) (PAGE_MMU_SLOT * PAGE_SIZE))
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Reserve a 8K page of RAM with the bank allocator of NextOS. The page stays
+reserved after the application has finished.
+@return Number of the page; PAGE_INVALID = "no memory"
+*/
+uint8_t pageAlloc(void);
+
+/*!
+Return a page to the bank allocator of NextOS
+@param uiPage Number of the page
+*/
+void pageFree(uint8_t uiPage);
+
+/*!
+Map a page into the MMU slot PAGE_MMU_SLOT. Interrupts are disabled until the
+page is unmapped, because slot 3 normally holds the BASIC program.
+@param uiPage Number of the page
+@return Logical address of the page
+*/
+void* pageMap(uint8_t uiPage);
+
+/*!
+Restore the MMU slot that was changed by "pageMap"
+*/
+void pageUnmap(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __PAGE_H__ */
@@ -0,0 +1,127 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: raster.h                                                           |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__RASTER_H__)
+  #define __RASTER_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Maximum number of scanlines that are sampled per frame
+*/
+#define RASTER_LINES_MAX  (8)
+
+/*!
+Maximum number of nregs that are sampled per scanline
+*/
+#define RASTER_REGS_MAX   (8)
+
+/*!
+Maximum number of frames that are sampled (~5 seconds)
+*/
+#define RASTER_FRAMES_MAX (250)
+
+/*!
+Number of the most frequent values that are reported per scanline and nreg
+*/
+#define RASTER_TOP_MAX    (4)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Parse the configuration of the profiler from the command line
+@code
+lines[:regs]  e.g. "0,96,191:16,17,26"
+lines         decimal numbers of the scanlines (same numbering as NR 0x22/0x23)
+regs          hexadecimal numbers of the nregs (default: scroll registers)
+@endcode
+@param acArg Argument of the option "-r"
+@return EOK = "no error"
+*/
+int rasterParse(const char_t* acArg);
+
+/*!
+Sample the configured nregs at the configured scanlines over many frames and
+output a histogram of the values per scanline and nreg.
+@return EOK = "no error"
+*/
+int rasterProfile(void);
+
+/*!
+Read the current scanline of the video output (NR 0x1E/0x1F). This works with
+disabled interrupts, too.
+@return Number of the scanline
+*/
+uint16_t rasterLine(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __RASTER_H__ */
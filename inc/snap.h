@@ -0,0 +1,117 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: snap.h                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__SNAP_H__)
+  #define __SNAP_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Identification of the snapshot page
+*/
+#define SNAP_MAGIC   "SYSN"
+
+/*!
+Version of the layout of the snapshot page
+*/
+#define SNAP_VERSION (0x01)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Layout of the snapshot page. It is filled by call 4 of the resident driver, so
+the offsets must match "drv/sysdrv.asm".
+*/
+typedef struct _snapshot
+{
+  char_t   acMagic[4];                     /* 0x000: SNAP_MAGIC              */
+  uint8_t  uiVersion;                      /* 0x004: SNAP_VERSION            */
+  uint8_t  uiRegCount;                     /* 0x005: entries of "auiList"    */
+  uint8_t  uiValid;                        /* 0x006: 1 = snapshot taken      */
+  uint8_t  auiReserved1[9];
+  uint16_t uiPC;                           /* 0x010: PC of the program       */
+  uint16_t uiSP;                           /* 0x012: SP of the program       */
+  uint8_t  auiFrames[3];                   /* 0x014: FRAMES                  */
+  uint8_t  auiReserved2[9];
+  uint8_t  auiList[CAPTURE_REGS_MAX];      /* 0x020: numbers of the nregs    */
+  uint8_t  auiRegs[CAPTURE_REGS_MAX];      /* 0x0C0: values of the nregs     */
+  uint8_t  auiVars[CAPTURE_VARS_SIZE];     /* 0x160: system variables        */
+} snapshot_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Show and keep a snapshot that was taken by the resident driver (if any) and
+arm the driver for the next snapshot.
+@return EOK = "no error"
+*/
+int snapArm(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __SNAP_H__ */
@@ -0,0 +1,152 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: stream.h                                                           |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__STREAM_H__)
+  #define __STREAM_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Identification of a capture stream
+*/
+#define STREAM_MAGIC     "SYSD"
+
+/*!
+Version of the format of the capture stream
+*/
+#define STREAM_VERSION   (0x01)
+
+/*!
+A keyframe (full capture) is written every n records
+*/
+#define STREAM_KEY_RATE  (64)
+
+/*!
+Type of a record: keyframe (RLE of the capture)
+*/
+#define STREAM_KEYFRAME  ('K')
+
+/*!
+Type of a record: delta (RLE of the capture XOR the previous capture)
+*/
+#define STREAM_DELTA     ('D')
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Header at the start of a capture stream
+*/
+typedef struct _streamhdr
+{
+  char_t   acMagic[4];  /* STREAM_MAGIC                                      */
+  uint8_t  uiVersion;   /* STREAM_VERSION                                    */
+  uint8_t  uiRegCount;  /* number of nregs per capture                       */
+  uint16_t uiVarSize;   /* number of bytes of system variables per capture   */
+  uint8_t  uiClipSize;  /* number of bytes of clip windows per capture       */
+  uint8_t  uiKeyRate;   /* a keyframe is written every n records             */
+} streamhdr_t;
+
+/*!
+Header of each record in a capture stream. The payload is a sequence of
+tokens: 0x00 - 0x7F = 1 - 128 literal bytes follow; 0x80 - 0xFF = 1 - 128
+zero bytes. The decoded data are the nregs, the system variables and the
+clip windows of the capture; for deltas XOR the previous capture.
+*/
+typedef struct _streamrec
+{
+  uint8_t  uiType;       /* STREAM_KEYFRAME, STREAM_DELTA                    */
+  uint8_t  auiFrames[3]; /* FRAMES                                           */
+  uint16_t uiLen;        /* size of the payload                              */
+} streamrec_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Write the header of a capture stream to the dump file
+@param pCapture First capture (defines the number of nregs)
+@return EOK = "no error"
+*/
+int streamBegin(const capture_t* pCapture);
+
+/*!
+Append a capture to the stream in the dump file (keyframe or delta)
+@param pPrev Previous capture (ignored for keyframes)
+@param pCurr Current capture
+@return EOK = "no error"
+*/
+int streamWrite(const capture_t* pPrev, const capture_t* pCurr);
+
+/*!
+Get the number of bytes written to the stream (headers included)
+@return Number of bytes
+*/
+uint32_t streamSize(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __STREAM_H__ */
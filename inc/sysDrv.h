@@ -0,0 +1,169 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: sysDrv.h                                                           |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__SYSDRV_H__)
+  #define __SYSDRV_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define DUMP_DRVNAME "%-14s"
+
+/*!
+ID of the resident NextOS driver "sysinfo.drv" (must match "drv/sysdrv.asm")
+*/
+#define SYSDRV_ID        (0x73)
+
+/*!
+Driver API call: Get version and number of fields (BC = version, DE = count)
+*/
+#define SYSDRV_CALL_STATUS (0x00)
+
+/*!
+Driver API call: Read a field (E = field, returns DE = value)
+*/
+#define SYSDRV_CALL_GET    (0x01)
+
+/*!
+Driver API call: Write a field (E = field, HL = value)
+*/
+#define SYSDRV_CALL_SET    (0x02)
+
+/*!
+Driver API call: Invalidate all fields
+*/
+#define SYSDRV_CALL_CLEAR  (0x03)
+
+/*!
+Driver API call: Take a snapshot into the snapshot page (DE = PC, HL = SP)
+*/
+#define SYSDRV_CALL_SNAP   (0x04)
+
+/*!
+Driver API call: Append an I/O trap to the trap page (DE = PC)
+*/
+#define SYSDRV_CALL_TRAP   (0x05)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Enumeration of all fields that are cached by the resident driver. Every field
+holds a 16 bit value.
+*/
+typedef enum _sysdrvfield
+{
+  SYSDRV_FIELD_MACHINEID   = 0, /*!< NR 0x00                               */
+  SYSDRV_FIELD_BOARDID     = 1, /*!< NR 0x0F                               */
+  SYSDRV_FIELD_COREVERSION = 2, /*!< (NR 0x01 << 8) | NR 0x0E              */
+  SYSDRV_FIELD_RAMSIZE     = 3, /*!< Number of 16K banks (MAXBNK + 1)      */
+  SYSDRV_FIELD_DRIVES      = 4, /*!< Bitmask of drives ('A' = bit 0)       */
+  SYSDRV_FIELD_DOSVERSION  = 5, /*!< Result of M_DOSVERSION                */
+  SYSDRV_FIELD_STATIC      = 6, /*!< Number of static fields               */
+  SYSDRV_FIELD_HISTPAGE    = 6, /*!< Page of the capture history           */
+  SYSDRV_FIELD_BGPAGE      = 7, /*!< Page of the background log            */
+  SYSDRV_FIELD_BGRATE      = 8, /*!< Frames between two records (0 = off)  */
+  SYSDRV_FIELD_BGNEXT      = 9, /*!< Offset of the next record (IM1)       */
+  SYSDRV_FIELD_BGCOUNT     =10, /*!< Number of records written (IM1)       */
+  SYSDRV_FIELD_SNAPPAGE    =11, /*!< Page of the NMI snapshot              */
+  SYSDRV_FIELD_TRAPPAGE    =12, /*!< Page of the I/O trap log              */
+  SYSDRV_FIELD_MAX
+} sysdrvfield_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Check, if the resident driver is installed
+@return "true" = driver is installed
+*/
+bool sysDrvPresent(void);
+
+/*!
+Read a single field from the resident driver
+@param eField Field to read
+@param pValue Pointer to store the value
+@return EOK = "no error"; ENOTSUP = "driver not installed or field not set"
+*/
+int sysDrvGet(uint8_t eField, uint16_t* pValue);
+
+/*!
+Write a single field of the resident driver
+@param eField  Field to write
+@param uiValue Value to store
+@return EOK = "no error"; ENOTSUP = "driver not installed"
+*/
+int sysDrvSet(uint8_t eField, uint16_t uiValue);
+
+/*!
+Capture all static system information once and store it in the resident
+driver. Afterwards the values are printed.
+@return EOK = "no error"
+*/
+int sysDrvStore(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __SYSDRV_H__ */
@@ -89,7 +89,21 @@ typedef enum _action
   ACTION_NONE = 0,
   ACTION_HELP,
   ACTION_INFO,
-  ACTION_DUMP
+  ACTION_DUMP,
+  ACTION_DRIVER,
+  ACTION_KEEP,
+  ACTION_LIST,
+  ACTION_FLUSH,
+  ACTION_RELEASE,
+  ACTION_DIFF,
+  ACTION_APPLY,
+  ACTION_WATCH,
+  ACTION_PANEL,
+  ACTION_RASTER,
+  ACTION_BGLOG,
+  ACTION_SNAP,
+  ACTION_IOTRAP,
+  ACTION_GPIO
 } action_t;
 
 /*!
@@ -109,7 +123,19 @@ typedef enum _features
 {
   FEATURE_REGISTERS = 0x01,
   FEATURE_NEXTOS    = 0x02,
-  FEATURE_SYSVARS   = 0x04
+  FEATURE_SYSVARS   = 0x04,
+  FEATURE_IRQLOAD   = 0x08,
+  FEATURE_COPYBENCH = 0x10,
+  FEATURE_DMABENCH  = 0x20,
+  FEATURE_CPUBENCH  = 0x40,
+  FEATURE_CONTBENCH = 0x80,
+  FEATURE_VIDBENCH  = 0x0100,
+  FEATURE_LATBENCH  = 0x0200,
+  FEATURE_SDBENCH   = 0x0400,
+  FEATURE_SDACCESS  = 0x0800,
+  FEATURE_OSBENCH   = 0x1000,
+  FEATURE_GFXBENCH  = 0x2000,
+  FEATURE_DEFAULT   = 0x07  /* all topics that don't take time */
 } features_t;
 
 /*============================================================================*/
@@ -126,12 +152,49 @@ Print a title line on the screen and the log file
 */
 int zheader(const char_t* acFmt, ...);
 
+/*!
+Collect the output of "zprintf" in a buffer instead of printing it. The text
+in the buffer is always terminated.
+@param acBuffer Buffer to collect the output (0 = print again)
+@param uiSize   Size of the buffer
+*/
+void zsink(char_t* acBuffer, uint16_t uiSize);
+
+/*!
+Output of a prerendered text block to the screen and the dump file (without
+formatting, in one go)
+@param acText Text to output
+@param uiLen  Length of the text
+*/
+void zwrite(const char_t* acText, uint16_t uiLen);
+
 /*!
 Internal function: The cpu speed is latched at startup of the application. The
 value read from the register is "28 MHz" because that is set at startup ...
 */
 uint8_t _cpuspeed(void);
 
+/*!
+Internal function: Change the cpu speed that is restored when the application
+ends (0 = 3.5 MHz ... 3 = 28 MHz)
+*/
+void _setcpuspeed(uint8_t uiSpeed);
+
+/*!
+Internal function: Handle of the open dump file (INV_FILE_HND = "no file")
+*/
+uint8_t _dumpfile(void);
+
+/*!
+Internal function: Number of columns of the current screen mode
+*/
+uint8_t _screencols(void);
+
+/*!
+Internal function: Check if the output to the screen is suppressed ("-q")
+*/
+bool _quiet(void);
+
 /*============================================================================*/
 /*                               Klassen                                      */
 /*============================================================================*/
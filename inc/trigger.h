@@ -0,0 +1,134 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: trigger.h                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__TRIGGER_H__)
+  #define __TRIGGER_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Maximum size of the compiled predicate in bytes
+*/
+#define TRIG_CODE_MAX  (0x40)
+
+/*!
+Maximum depth of the stack to evaluate the predicate
+*/
+#define TRIG_STACK_MAX (8)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Operations of the compiled predicate (postfix, evaluated on a stack)
+*/
+typedef enum _trigop
+{
+  TRIG_OP_END = 0,  /* end of code; result = top of stack  */
+  TRIG_OP_REG,      /* push value of nreg (index in capture) */
+  TRIG_OP_VAR8,     /* push 8 bit sysvar (offset in capture) */
+  TRIG_OP_VAR16,    /* push 16 bit sysvar (offset in capture) */
+  TRIG_OP_CONST,    /* push 16 bit constant                */
+  TRIG_OP_AND,      /* a & b                               */
+  TRIG_OP_EQ,       /* a == b                              */
+  TRIG_OP_NE,       /* a != b                              */
+  TRIG_OP_LT,       /* a < b                               */
+  TRIG_OP_GT,       /* a > b                               */
+  TRIG_OP_LE,       /* a <= b                              */
+  TRIG_OP_GE,       /* a >= b                              */
+  TRIG_OP_LAND,     /* a && b                              */
+  TRIG_OP_LOR       /* a || b                              */
+} trigop_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Compile a trigger expression into the internal bytecode. Operands are names of
+nregs or system variables and numbers (decimal or "0x.."). Operators are
+"&", "==", "!=", "<", ">", "<=", ">=", "&&" and "||". Unlike C, "&" binds
+stronger than the comparisons, so "IRQSTATUS0&2==2" works as expected.
+@param acExpr Expression, e.g. "MMUSLT7CTRL!=0x01&&IRQSTATUS0&0x02"
+@return EOK = "no error"
+*/
+int trigCompile(const char_t* acExpr);
+
+/*!
+Check if a predicate has been compiled
+@return "true" = trigger is active
+*/
+bool trigActive(void);
+
+/*!
+Evaluate the compiled predicate against a raw capture
+@param pCapture Raw capture
+@return "true" = the predicate is true
+*/
+bool trigEval(const capture_t* pCapture);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __TRIGGER_H__ */
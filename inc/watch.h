@@ -0,0 +1,110 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: watch.h                                                            |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__WATCH_H__)
+  #define __WATCH_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Formatstring of the frame stamp of a logged change
+*/
+#define DUMP_FRAMES "%6lu"
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Capture all nregs and system variables every "uiFrames" frames and log only
+the entries that have changed (stamped with FRAMES) until BREAK is pressed.
+If a trigger is compiled, only the captures where the trigger becomes true are
+stored in the history page instead.
+@param uiFrames Number of frames between two captures (0 = every frame)
+@param bStream  "true" = all captures are written as compressed stream (delta
+                + RLE) to the dump file instead of the text log
+@return EOK = "no error"
+*/
+int watchCapture(uint8_t uiFrames, bool bStream);
+
+/*!
+Wait for the given number of frames (interrupts must be enabled)
+@param uiFrames Number of frames to wait
+*/
+void watchWait(uint8_t uiFrames);
+
+/*!
+Check if BREAK (CAPS SHIFT + SPACE) is pressed
+@return "true" = BREAK is pressed
+*/
+bool watchBreak(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __WATCH_H__ */
@@ -0,0 +1,266 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: apply.c                                                            |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "dumpRegs.h"
+#include "capture.h"
+#include "history.h"
+#include "apply.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Flag: The value is written as it is
+*/
+#define APPLY_FLAG_PLAIN (0x00)
+
+/*!
+Flag: All four coordinates of a clip window are written (NR 0x18 - 0x1B)
+*/
+#define APPLY_FLAG_CLIP  (0x01)
+
+/*!
+Flag: The cpu speed is latched and set by the application at exit
+*/
+#define APPLY_FLAG_SPEED (0x02)
+
+/*!
+Flag: The nreg is in use by the running application and can't be restored
+*/
+#define APPLY_FLAG_INUSE (0x80)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+List of all nregs that are restored (in this order). All other nregs are read
+only, change the machine configuration or are dangerous to rewrite (reset,
+memory mapping of the ROMs, copper, interrupts, expansion bus, ...).
+*/
+static const applyentry_t g_tApplyList[] =
+{
+  {0x07, APPLY_FLAG_SPEED}, /* CPUSPEED    */
+  {0x12, APPLY_FLAG_PLAIN}, /* L2ACTRAMBNK */
+  {0x13, APPLY_FLAG_PLAIN}, /* L2SHARAMBNK */
+  {0x14, APPLY_FLAG_PLAIN}, /* GLBTRNSCLR  */
+  {0x15, APPLY_FLAG_PLAIN}, /* SPRLYSYSSTP */
+  {0x16, APPLY_FLAG_PLAIN}, /* L2HSCRLCTRL */
+  {0x17, APPLY_FLAG_PLAIN}, /* L2VSCRLCTRL */
+  {0x18, APPLY_FLAG_CLIP }, /* L2CLPWINDEF */
+  {0x19, APPLY_FLAG_CLIP }, /* SPCLPWINDEF */
+  {0x1A, APPLY_FLAG_CLIP }, /* L0CLPWINDEF */
+  {0x1B, APPLY_FLAG_CLIP }, /* L3CLPWINDEF */
+  {0x26, APPLY_FLAG_PLAIN}, /* ULAHSCRCTRL */
+  {0x27, APPLY_FLAG_PLAIN}, /* ULAVSCRCTRL */
+  {0x2F, APPLY_FLAG_PLAIN}, /* L3HSCRCTRLM */
+  {0x30, APPLY_FLAG_PLAIN}, /* L3HSCRCTRLL */
+  {0x31, APPLY_FLAG_PLAIN}, /* L3VSCRCTRL  */
+  {0x32, APPLY_FLAG_PLAIN}, /* L10HSCRCTRL */
+  {0x33, APPLY_FLAG_PLAIN}, /* L10VSCRCTRL */
+  {0x40, APPLY_FLAG_PLAIN}, /* PALINDEXSEL */
+  {0x42, APPLY_FLAG_PLAIN}, /* EULAATTRFMT */
+  {0x43, APPLY_FLAG_PLAIN}, /* PALETTECTRL */
+  {0x4A, APPLY_FLAG_PLAIN}, /* FBACKCOLVAL */
+  {0x4B, APPLY_FLAG_PLAIN}, /* SPRTRNSPIDX */
+  {0x4C, APPLY_FLAG_PLAIN}, /* L3TRNSPIDX  */
+  {0x50, APPLY_FLAG_INUSE}, /* MMUSLT0CTRL */
+  {0x51, APPLY_FLAG_INUSE}, /* MMUSLT1CTRL */
+  {0x52, APPLY_FLAG_INUSE}, /* MMUSLT2CTRL */
+  {0x53, APPLY_FLAG_INUSE}, /* MMUSLT3CTRL */
+  {0x54, APPLY_FLAG_INUSE}, /* MMUSLT4CTRL */
+  {0x55, APPLY_FLAG_INUSE}, /* MMUSLT5CTRL */
+  {0x56, APPLY_FLAG_INUSE}, /* MMUSLT6CTRL */
+  {0x57, APPLY_FLAG_INUSE}, /* MMUSLT7CTRL */
+  {0x68, APPLY_FLAG_PLAIN}, /* ULACTRL     */
+  {0x69, APPLY_FLAG_PLAIN}, /* DISPCTRL1   */
+  {0x6A, APPLY_FLAG_PLAIN}, /* LAYER01CTRL */
+  {0x6B, APPLY_FLAG_PLAIN}, /* LAYER3CTRL  */
+  {0x6C, APPLY_FLAG_PLAIN}, /* L3DEFATTR   */
+  {0x6E, APPLY_FLAG_PLAIN}, /* L3BASEADDR  */
+  {0x6F, APPLY_FLAG_PLAIN}, /* L3TILEBASAD */
+  {0x70, APPLY_FLAG_PLAIN}, /* L2RSLTNCTRL */
+  {0x71, APPLY_FLAG_PLAIN}, /* L2HSCRLCTLM */
+  /* ---------------------- */
+  {0x00, 0xFF}
+};
+
+/*!
+Capture to restore (too big for the stack)
+*/
+static capture_t g_tApply;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Find the index of a nreg in "g_tRegisters" (= index in a capture)
+@param uiNumber Number of the nreg
+@return Index; 0xFF = "nreg not captured"
+*/
+static uint8_t applyIndex(uint8_t uiNumber);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* applyIndex()                                                               */
+/*----------------------------------------------------------------------------*/
+static uint8_t applyIndex(uint8_t uiNumber)
+{
+  for (uint8_t i = 0; 0 != g_tRegisters[i].acName; ++i)
+  {
+    if (g_tRegisters[i].uiNumber == uiNumber)
+    {
+      return i;
+    }
+  }
+
+  return 0xFF;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* applyCapture()                                                             */
+/*----------------------------------------------------------------------------*/
+int applyCapture(const char_t* acPathName)
+{
+  int iReturn = EOK;
+  uint8_t auiIndex[sizeof(g_tApplyList) / sizeof(g_tApplyList[0])];
+  uint8_t uiApplied = 0;
+
+  if (EOK == (iReturn = histLoad(acPathName, &g_tApply)))
+  {
+    /* Precompute the write list, so the nregs are written in one go */
+    for (uint8_t i = 0; 0xFF != g_tApplyList[i].uiFlags; ++i)
+    {
+      auiIndex[i] = applyIndex(g_tApplyList[i].uiNumber);
+    }
+  }
+  else if (ENOTSUP == iReturn)
+  {
+    iReturn = EINVAL; /* Error: text dumps can't be applied */
+  }
+
+  if (EOK == iReturn)
+  {
+    for (uint8_t i = 0; 0xFF != g_tApplyList[i].uiFlags; ++i)
+    {
+      const applyentry_t* pEntry = &g_tApplyList[i];
+      uint8_t uiValue;
+
+      if ((0xFF == auiIndex[i]) || (auiIndex[i] >= g_tApply.uiRegCount))
+      {
+        continue;
+      }
+
+      uiValue = g_tApply.auiRegs[auiIndex[i]];
+
+      switch (pEntry->uiFlags)
+      {
+        case APPLY_FLAG_SPEED:
+          _setcpuspeed(uiValue & 0x03);
+          break;
+
+        case APPLY_FLAG_CLIP:
+          {
+            uint8_t uiWindow = pEntry->uiNumber - 0x18;
+
+            ZXN_WRITE_REG(0x1C, 1 << uiWindow); /* reset index */
+            for (uint8_t j = 0; j < 4; ++j)
+            {
+              ZXN_WRITE_REG(pEntry->uiNumber, g_tApply.auiClip[uiWindow][j]);
+            }
+          }
+          break;
+
+        case APPLY_FLAG_INUSE:
+          DBGPRINTF("apply() - skipped 0x%02X\n", pEntry->uiNumber);
+          continue;
+
+        default:
+          ZXN_WRITE_REG(pEntry->uiNumber, uiValue);
+      }
+
+      zprintf(DUMP_REGNUM "-" DUMP_REGNAME " = 0x%02X\n", pEntry->uiNumber, g_tRegisters[auiIndex[i]].acName, uiValue);
+      ++uiApplied;
+    }
+
+    /*
+    REMARK: The MMU slots hold the ROM, the system variables and the pages of
+            this application while it is running. NextOS restores them when the
+            application ends, so they can't be restored from here ...
+    */
+    zheader("%u NREGS APPLIED (MMU SKIPPED)", uiApplied);
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
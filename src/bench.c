@@ -0,0 +1,371 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: bench.c                                                            |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <z80.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "raster.h"
+#include "bench.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Names of the CPU speeds
+*/
+const char_t* g_acSpeedNames[BENCH_SPEEDS] = {"3.5", "7", "14", "28"};
+
+/*!
+Display timings (NR 0x03 bits 6:4); 0 lines = "unknown"
+*/
+static const benchdisplay_t g_tDisplays[8] =
+{
+  {"CONFIG",     0, {  0,   0}},
+  {"48K",      224, {312, 264}},
+  {"128K",     228, {311, 264}},
+  {"+3",       228, {311, 264}},
+  {"PENTAGON", 224, {320, 320}},
+  {"?",          0, {  0,   0}},
+  {"?",          0, {  0,   0}},
+  {"?",          0, {  0,   0}}
+};
+
+/*!
+Master clocks of the video timings (NR 0x11 bits 2:0); "28 MHz" is derived
+from the master clock, the frames too.
+*/
+static const benchtiming_t g_tTimings[8] =
+{
+  {"VGA0", 28000},
+  {"VGA1", 28571},
+  {"VGA2", 29464},
+  {"VGA3", 30000},
+  {"VGA4", 31000},
+  {"VGA5", 32000},
+  {"VGA6", 33000},
+  {"HDMI", 27000}
+};
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+T-states of the measuring loop (per call of an empty function) at each CPU
+speed (0 = "not measured yet")
+*/
+static uint16_t g_auiOverhead[BENCH_SPEEDS];
+
+/*!
+Raw value of the stopwatch at the start (down counter)
+*/
+static uint32_t g_uiWatchStart;
+
+/*!
+Lines between the start and the end of the last "benchRun" (beyond the whole
+frames; may be negative)
+*/
+static int16_t g_iRunLines;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Empty function to measure the time of the measuring loop
+*/
+static void benchNop(void);
+
+/*!
+Raw value of the stopwatch (down counter, 24 bit)
+*/
+static uint32_t benchWatchRaw(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* benchRun()                                                                 */
+/*----------------------------------------------------------------------------*/
+uint32_t benchRun(benchfn_t pFn, uint8_t uiFrames)
+{
+  uint32_t uiCalls = 0;
+  uint16_t uiFirst;
+  uint16_t uiLast;
+  uint16_t uiLine;
+
+  /* Start at the beginning of a frame */
+  uiLast = rasterLine();
+  while ((uiLine = rasterLine()) >= uiLast)
+  {
+    uiLast = uiLine;
+  }
+  uiLast = uiLine;
+  uiFirst = uiLine;
+
+  while (0 != uiFrames)
+  {
+    pFn();
+    ++uiCalls;
+
+    if ((uiLine = rasterLine()) < uiLast) /* new frame */
+    {
+      --uiFrames;
+    }
+    uiLast = uiLine;
+  }
+
+  g_iRunLines = ((int16_t) uiLast) - ((int16_t) uiFirst);
+
+  return uiCalls;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchCycles()                                                              */
+/*----------------------------------------------------------------------------*/
+uint32_t benchCycles(benchfn_t pFn, uint8_t uiFrames)
+{
+  const uint8_t  uiSpeed  = (ZXN_READ_REG(0x07) >> 4) & 0x03;
+  const uint32_t uiFrameT = benchFrameCycles();
+  const uint32_t uiWindow = uiFrameT * uiFrames;
+  const int32_t  iLineT   = ((int32_t) benchDisplay()->uiLineT) << uiSpeed; /* 0 = unknown */
+  uint32_t uiCalls;
+  uint32_t uiCycles;
+
+  if (0 == g_auiOverhead[uiSpeed])
+  {
+    uiCalls = benchRun(benchNop, uiFrames);
+    g_auiOverhead[uiSpeed] = (uint16_t) ((uiWindow + (g_iRunLines * iLineT)) / uiCalls);
+  }
+
+  /* The window ends with the first call after the last frame */
+  uiCalls  = benchRun(pFn, uiFrames);
+  uiCycles = (uiWindow + (g_iRunLines * iLineT)) / uiCalls;
+
+  return (uiCycles > g_auiOverhead[uiSpeed] ? uiCycles - g_auiOverhead[uiSpeed] : 0);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchClock()                                                               */
+/*----------------------------------------------------------------------------*/
+uint16_t benchClock(void)
+{
+  return 3500 << ((ZXN_READ_REG(0x07) >> 4) & 0x03); /* actual speed */
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchFrameRate()                                                           */
+/*----------------------------------------------------------------------------*/
+uint8_t benchFrameRate(void)
+{
+  return (ZXN_READ_REG(0x05) & (1 << 2) ? 60 : 50);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchDisplay()                                                             */
+/*----------------------------------------------------------------------------*/
+const benchdisplay_t* benchDisplay(void)
+{
+  return &g_tDisplays[(ZXN_READ_REG(0x03) >> 4) & 0x07];
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchTiming()                                                              */
+/*----------------------------------------------------------------------------*/
+const benchtiming_t* benchTiming(void)
+{
+  return &g_tTimings[ZXN_READ_REG(0x11) & 0x07];
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchFrameCycles()                                                         */
+/*----------------------------------------------------------------------------*/
+uint32_t benchFrameCycles(void)
+{
+  const benchdisplay_t* pDisplay = benchDisplay();
+  const uint8_t uiSpeed = (ZXN_READ_REG(0x07) >> 4) & 0x03;
+
+  if (0 == pDisplay->uiLineT)
+  {
+    return (((uint32_t) benchClock()) * 1000) / benchFrameRate();
+  }
+
+  /* e.g. 48K: 224 T x 312 lines = 69888 T at 3.5 MHz */
+  return (((uint32_t) pDisplay->uiLineT) * pDisplay->auiLines[60 == benchFrameRate() ? 1 : 0]) << uiSpeed;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSpeed()                                                               */
+/*----------------------------------------------------------------------------*/
+void benchSpeed(uint8_t uiSpeed)
+{
+  ZXN_WRITE_REG(0x07, uiSpeed & 0x03); /* "benchClock" reads the actual speed */
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchWatchStart()                                                          */
+/*----------------------------------------------------------------------------*/
+void benchWatchStart(void)
+{
+  z80_outp(BENCH_WATCH_CTC(0), 0x25); /* timer, prescaler 256, TC follows   */
+  z80_outp(BENCH_WATCH_CTC(0), 0x00);
+  z80_outp(BENCH_WATCH_CTC(1), 0x45); /* counter: ZC/TO of the channel before */
+  z80_outp(BENCH_WATCH_CTC(1), 0x00);
+  z80_outp(BENCH_WATCH_CTC(2), 0x45);
+  z80_outp(BENCH_WATCH_CTC(2), 0x00);
+
+  g_uiWatchStart = benchWatchRaw();
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchWatchRead()                                                           */
+/*----------------------------------------------------------------------------*/
+uint32_t benchWatchRead(void)
+{
+  return (g_uiWatchStart - benchWatchRaw()) & 0x00FFFFFF;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchWatchStop()                                                           */
+/*----------------------------------------------------------------------------*/
+void benchWatchStop(void)
+{
+  for (uint8_t i = 0; i < 3; ++i)
+  {
+    z80_outp(BENCH_WATCH_CTC(i), 0x03); /* reset */
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSort()                                                                */
+/*----------------------------------------------------------------------------*/
+void benchSort(uint16_t* pValues, uint8_t uiCount)
+{
+  for (uint8_t i = 1; i < uiCount; ++i)
+  {
+    const uint16_t uiValue = pValues[i];
+    uint8_t j = i;
+
+    while ((0 < j) && (pValues[j - 1] > uiValue))
+    {
+      pValues[j] = pValues[j - 1];
+      --j;
+    }
+
+    pValues[j] = uiValue;
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchPercentile()                                                          */
+/*----------------------------------------------------------------------------*/
+uint16_t benchPercentile(const uint16_t* pSorted, uint8_t uiCount, uint8_t uiPercent)
+{
+  const uint16_t uiIndex = (((uint16_t) uiCount) * uiPercent) / 100;
+
+  return pSorted[uiIndex < uiCount ? uiIndex : uiCount - 1];
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchWatchRaw()                                                            */
+/*----------------------------------------------------------------------------*/
+static uint32_t benchWatchRaw(void)
+{
+  uint8_t uiHi;
+  uint8_t uiMid;
+  uint8_t uiLo;
+
+  /* The low byte is read between the higher ones; retry, if they changed */
+  do
+  {
+    uiHi  = z80_inp(BENCH_WATCH_CTC(2));
+    uiMid = z80_inp(BENCH_WATCH_CTC(1));
+    uiLo  = z80_inp(BENCH_WATCH_CTC(0));
+  }
+  while ((uiMid != z80_inp(BENCH_WATCH_CTC(1))) || (uiHi != z80_inp(BENCH_WATCH_CTC(2))));
+
+  return (((uint32_t) uiHi) << 16) | (((uint16_t) uiMid) << 8) | uiLo;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchNop()                                                                 */
+/*----------------------------------------------------------------------------*/
+static void benchNop(void)
+{
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,270 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchCont.c                                                        |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <errno.h>
+#include <intrinsic.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "bench.h"
+#include "benchCont.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define BENCHCONT_SLOTS (BENCHCONT_LAST - BENCHCONT_FIRST + 1)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Address of the data accessed by "benchContLoop"
+*/
+static uint16_t g_uiContAddr;
+
+/*!
+Section bounds of the linker: first byte of the code and the byte after the
+end of the BSS (the program incl. data, BSS and heap)
+*/
+extern uint8_t _CODE_head[];
+extern uint8_t _BSS_END_tail[];
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Kind of page mapped into the slots
+*/
+typedef struct _benchkind
+{
+  const char_t* acName;
+  uint8_t       uiPage;                    /* PAGE_INVALID = allocated page   */
+} benchkind_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Check, if a slot is in use by the measurement itself (stack, code, data)
+@param uiSlot MMU slot
+@return true = "slot is in use"
+*/
+static bool benchContUsed(uint8_t uiSlot);
+
+/*!
+Test loop: reads and writes the data at "g_uiContAddr" (content is kept)
+*/
+static void benchContLoop(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Kinds of pages; banks 1, 4, 5 and 7 are contended on some machine timings
+*/
+static const benchkind_t g_tKinds[] =
+{
+  {"PG", PAGE_INVALID},
+  {"B0",  0},
+  {"B1",  2},
+  {"B4",  8},
+  {"B5", 10},
+  {"B7", 14},
+  {0,     0}
+};
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpContentionBench()                                                      */
+/*----------------------------------------------------------------------------*/
+int dumpContentionBench(void)
+{
+  static uint16_t auiResult[BENCH_SPEEDS][sizeof(g_tKinds) / sizeof(g_tKinds[0])][BENCHCONT_SLOTS];
+  uint8_t  uiAlloc;
+  uint8_t  uiRef = 0xFF;
+
+  if (PAGE_INVALID == (uiAlloc = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  intrinsic_di();
+
+  for (uint8_t uiSpeed = 0; uiSpeed < BENCH_SPEEDS; ++uiSpeed)
+  {
+    benchSpeed(uiSpeed);
+
+    for (uint8_t i = 0; 0 != g_tKinds[i].acName; ++i)
+    {
+      for (uint8_t uiSlot = BENCHCONT_FIRST; uiSlot <= BENCHCONT_LAST; ++uiSlot)
+      {
+        uint8_t uiSaved;
+
+        if (benchContUsed(uiSlot))
+        {
+          auiResult[uiSpeed][i][uiSlot - BENCHCONT_FIRST] = 0;
+          continue;
+        }
+
+        if (0xFF == uiRef)
+        {
+          uiRef = uiSlot - BENCHCONT_FIRST;
+        }
+
+        uiSaved = ZXN_READ_REG(0x50 + uiSlot);
+        ZXN_WRITE_REG(0x50 + uiSlot, PAGE_INVALID == g_tKinds[i].uiPage ? uiAlloc : g_tKinds[i].uiPage);
+
+        g_uiContAddr = (((uint16_t) uiSlot) << 13) + BENCHCONT_OFFSET;
+        auiResult[uiSpeed][i][uiSlot - BENCHCONT_FIRST] = (uint16_t) benchCycles(benchContLoop, BENCH_FRAMES);
+
+        ZXN_WRITE_REG(0x50 + uiSlot, uiSaved);
+      }
+    }
+  }
+
+  benchSpeed(RTM_28MHZ);
+  intrinsic_ei();
+
+  pageFree(uiAlloc);
+
+  zheader("MEMORY CONTENTION (T/ACCESS)");
+
+  if (0xFF == uiRef)
+  {
+    return EOK; /* no free slot */
+  }
+
+  for (uint8_t uiSpeed = 0; uiSpeed < BENCH_SPEEDS; ++uiSpeed)
+  {
+    const uint16_t uiBase = auiResult[uiSpeed][0][uiRef];
+
+    zprintf("CPU %s MHZ\n", g_acSpeedNames[uiSpeed]);
+    zprintf("  ");
+
+    for (uint8_t uiSlot = BENCHCONT_FIRST; uiSlot <= BENCHCONT_LAST; ++uiSlot)
+    {
+      zprintf("  S%u", uiSlot);
+    }
+
+    zprintf("\n");
+
+    for (uint8_t i = 0; 0 != g_tKinds[i].acName; ++i)
+    {
+      zprintf("%s", g_tKinds[i].acName);
+
+      for (uint8_t j = 0; j < BENCHCONT_SLOTS; ++j)
+      {
+        const uint16_t uiCycles = auiResult[uiSpeed][i][j];
+        uint16_t uiWait;
+
+        if (0 == uiCycles)
+        {
+          zprintf("  --");
+          continue;
+        }
+
+        uiWait = (uiCycles > uiBase ? ((uiCycles - uiBase) * 10) / (BENCHCONT_ITER * 4) : 0);
+        uiWait = (uiWait > 99 ? 99 : uiWait);
+
+        zprintf(" %u.%u", uiWait / 10, uiWait % 10);
+      }
+
+      zprintf("\n");
+    }
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchContUsed()                                                            */
+/*----------------------------------------------------------------------------*/
+static bool benchContUsed(uint8_t uiSlot)
+{
+  uint8_t uiStack; /* address of a local = stack */
+
+  return (uiSlot == (((uint16_t) &uiStack) >> 13)) ||
+         ((uiSlot >= (((uint16_t) _CODE_head) >> 13)) &&
+          (uiSlot <= ((((uint16_t) _BSS_END_tail) - 1) >> 13)));
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchContLoop()                                                            */
+/*----------------------------------------------------------------------------*/
+static void benchContLoop(void) __naked
+{
+  __asm
+    ld    hl, (_g_uiContAddr)
+    ld    b, 16                 ; BENCHCONT_ITER
+00101$:
+    ld    a, (hl)               ; 4 data accesses per iteration
+    ld    (hl), a
+    inc   l
+    ld    a, (hl)
+    ld    (hl), a
+    inc   l
+    djnz  00101$
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
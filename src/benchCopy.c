@@ -0,0 +1,453 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchCopy.c                                                        |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "bench.h"
+#include "benchCopy.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Flags of a primitive and a pair of memory kinds
+*/
+#define BENCHCOPY_FILL    (0x01) /* fill instead of copy                      */
+#define BENCHCOPY_REVERSE (0x02) /* source is read backwards (LDDRX)          */
+#define BENCHCOPY_PREFILL (0x04) /* source gets the content of the target     */
+#define BENCHCOPY_SAME    (0x08) /* source = target (content is unchanged)    */
+#define BENCHCOPY_SAVE    (0x10) /* target is saved and restored              */
+#define BENCHCOPY_BANK7   (0x20) /* bank 7 instead of the allocated page      */
+
+/*!
+Addresses of the kinds of memory
+*/
+#define BENCHCOPY_DIVMMC  (0x2000) /* code of the dot command                 */
+#define BENCHCOPY_BANK5   (0x4000) /* screen (ULA contended)                  */
+#define BENCHCOPY_SRC     (0x6000) /* allocated page or bank 7 (slot 3)       */
+#define BENCHCOPY_DST     (0x7000)
+#define BENCHCOPY_BACKUP  (0x7800)
+
+/*!
+Page of bank 7 (lower half)
+*/
+#define BENCHCOPY_PAGE7   (14)
+
+/*!
+Marker of a skipped measurement
+*/
+#define BENCHCOPY_SKIPPED (0xFFFF)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Arguments of the primitives (used by the assembler code)
+*/
+static uint8_t* g_pBenchSrc;
+static uint8_t* g_pBenchDst;
+static uint16_t g_uiBenchLen = BENCHCOPY_LEN;
+static uint16_t g_uiBenchSp;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Block copy/fill primitive
+*/
+typedef struct _benchprim
+{
+  const char_t* acName;
+  benchfn_t     pFn;
+  uint8_t       uiFlags;
+} benchprim_t;
+
+/*!
+Source and target of a primitive
+*/
+typedef struct _benchpair
+{
+  const char_t* acName;
+  uint16_t      uiSrc;
+  uint16_t      uiDst;
+  uint8_t       uiFlags;
+} benchpair_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+static void benchLdir(void);
+static void benchLdirx(void);
+static void benchLddrx(void);
+static void benchLdi16(void);
+static void benchPush(void);
+static void benchLdpirx(void);
+
+/*!
+Measure a single primitive with a pair of memory kinds
+@param pPrim Primitive
+@param pPair Source and target
+@return kB/s; BENCHCOPY_SKIPPED = "not possible"
+*/
+static uint16_t benchCopyRun(const benchprim_t* pPrim, const benchpair_t* pPair);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Table of all primitives
+*/
+static const benchprim_t g_tPrims[] =
+{
+  {"LDIR",   benchLdir,   0                },
+  {"LDIRX",  benchLdirx,  0                },
+  {"LDDRX",  benchLddrx,  BENCHCOPY_REVERSE},
+  {"LDI*16", benchLdi16,  0                },
+  {"PUSH",   benchPush,   BENCHCOPY_FILL   },
+  {"LDPIRX", benchLdpirx, BENCHCOPY_FILL   },
+  {0,        0,           0                }
+};
+
+/*!
+Table of all pairs of memory kinds. Targets that are in use (screen, code of
+the dot command, bank 7 of NextOS) are written with their own content.
+*/
+static const benchpair_t g_tPairs[] =
+{
+  {"PG>PG", BENCHCOPY_SRC,    BENCHCOPY_DST,    0                                },
+  {"PG>B5", BENCHCOPY_SRC,    BENCHCOPY_BANK5,  BENCHCOPY_PREFILL                },
+  {"B5>PG", BENCHCOPY_BANK5,  BENCHCOPY_DST,    0                                },
+  {"B5>B5", BENCHCOPY_BANK5,  BENCHCOPY_BANK5,  BENCHCOPY_SAME                   },
+  {"PG>DV", BENCHCOPY_SRC,    BENCHCOPY_DIVMMC, BENCHCOPY_PREFILL                },
+  {"DV>PG", BENCHCOPY_DIVMMC, BENCHCOPY_DST,    0                                },
+  {"DV>DV", BENCHCOPY_DIVMMC, BENCHCOPY_DIVMMC, BENCHCOPY_SAME                   },
+  {"B7>B7", BENCHCOPY_SRC,    BENCHCOPY_SRC,    BENCHCOPY_SAME | BENCHCOPY_BANK7 },
+  {">PG",   BENCHCOPY_SRC,    BENCHCOPY_DST,    BENCHCOPY_FILL                   },
+  {">B5",   BENCHCOPY_SRC,    BENCHCOPY_BANK5,  BENCHCOPY_FILL | BENCHCOPY_SAVE  },
+  {0,       0,                0,                0                                }
+};
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpCopyBench()                                                            */
+/*----------------------------------------------------------------------------*/
+int dumpCopyBench(void)
+{
+  static uint16_t auiResult[BENCH_SPEEDS][sizeof(g_tPrims) / sizeof(g_tPrims[0])][sizeof(g_tPairs) / sizeof(g_tPairs[0])];
+  uint8_t uiPage;
+
+  if (PAGE_INVALID == (uiPage = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  zheader("MEMORY COPY (KB/S)");
+
+  for (uint8_t uiSpeed = 0; uiSpeed < BENCH_SPEEDS; ++uiSpeed)
+  {
+    benchSpeed(uiSpeed);
+
+    for (uint8_t i = 0; 0 != g_tPrims[i].acName; ++i)
+    {
+      for (uint8_t j = 0; 0 != g_tPairs[j].acName; ++j)
+      {
+        if ((g_tPrims[i].uiFlags ^ g_tPairs[j].uiFlags) & BENCHCOPY_FILL)
+        {
+          continue; /* copy primitive with fill target or vice versa */
+        }
+
+        (void) pageMap(g_tPairs[j].uiFlags & BENCHCOPY_BANK7 ? BENCHCOPY_PAGE7 : uiPage);
+        auiResult[uiSpeed][i][j] = benchCopyRun(&g_tPrims[i], &g_tPairs[j]);
+        pageUnmap();
+      }
+    }
+  }
+
+  benchSpeed(RTM_28MHZ);
+  pageFree(uiPage);
+
+  for (uint8_t uiSpeed = 0; uiSpeed < BENCH_SPEEDS; ++uiSpeed)
+  {
+    zprintf("CPU %s MHZ\n", g_acSpeedNames[uiSpeed]);
+
+    for (uint8_t i = 0; 0 != g_tPrims[i].acName; ++i)
+    {
+      for (uint8_t j = 0; 0 != g_tPairs[j].acName; ++j)
+      {
+        if ((g_tPrims[i].uiFlags ^ g_tPairs[j].uiFlags) & BENCHCOPY_FILL)
+        {
+          continue;
+        }
+
+        if (BENCHCOPY_SKIPPED != auiResult[uiSpeed][i][j])
+        {
+          zprintf(DUMP_BENCHNAME " %-5s = %5u\n", g_tPrims[i].acName, g_tPairs[j].acName, auiResult[uiSpeed][i][j]);
+        }
+        else
+        {
+          zprintf(DUMP_BENCHNAME " %-5s =     -\n", g_tPrims[i].acName, g_tPairs[j].acName);
+        }
+      }
+    }
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchCopyRun()                                                             */
+/*----------------------------------------------------------------------------*/
+static uint16_t benchCopyRun(const benchprim_t* pPrim, const benchpair_t* pPair)
+{
+  uint32_t uiCycles;
+
+  if ((pPrim->uiFlags & BENCHCOPY_REVERSE) && (pPair->uiFlags & BENCHCOPY_SAME))
+  {
+    return BENCHCOPY_SKIPPED; /* would mirror the content of the target */
+  }
+
+  g_pBenchSrc = (uint8_t*) pPair->uiSrc;
+  g_pBenchDst = (uint8_t*) pPair->uiDst;
+
+  if (pPair->uiFlags & BENCHCOPY_PREFILL)
+  {
+    if (pPrim->uiFlags & BENCHCOPY_REVERSE)
+    {
+      for (uint16_t i = 0; i < BENCHCOPY_LEN; ++i)
+      {
+        g_pBenchSrc[i] = g_pBenchDst[BENCHCOPY_LEN - 1 - i];
+      }
+    }
+    else
+    {
+      memcpy(g_pBenchSrc, g_pBenchDst, BENCHCOPY_LEN);
+    }
+  }
+  else if ((BENCHCOPY_SRC == pPair->uiSrc) && !(pPair->uiFlags & (BENCHCOPY_SAME | BENCHCOPY_BANK7)))
+  {
+    for (uint16_t i = 0; i < BENCHCOPY_LEN; ++i)
+    {
+      g_pBenchSrc[i] = (uint8_t) i; /* pattern of the allocated page */
+    }
+  }
+
+  if (pPair->uiFlags & BENCHCOPY_SAVE)
+  {
+    memcpy((void*) BENCHCOPY_BACKUP, g_pBenchDst, BENCHCOPY_LEN);
+  }
+
+  uiCycles = benchCycles(pPrim->pFn, BENCH_FRAMES);
+
+  if (pPair->uiFlags & BENCHCOPY_SAVE)
+  {
+    memcpy(g_pBenchDst, (void*) BENCHCOPY_BACKUP, BENCHCOPY_LEN);
+  }
+
+  /* bytes * kHz / T-states = kB/s */
+  return (0 != uiCycles ? (uint16_t) ((((uint32_t) BENCHCOPY_LEN) * benchClock()) / uiCycles) : 0);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLdir()                                                                */
+/*----------------------------------------------------------------------------*/
+static void benchLdir(void) __naked
+{
+  __asm
+    ld    hl, (_g_pBenchSrc)
+    ld    de, (_g_pBenchDst)
+    ld    bc, (_g_uiBenchLen)
+    ldir
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLdirx()                                                               */
+/*----------------------------------------------------------------------------*/
+static void benchLdirx(void) __naked
+{
+  __asm
+    ld    hl, (_g_pBenchSrc)
+    ld    de, (_g_pBenchDst)
+    ld    bc, (_g_uiBenchLen)
+    ld    a, 0xE3               ; transparent byte
+    ldirx
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLddrx()                                                               */
+/*----------------------------------------------------------------------------*/
+static void benchLddrx(void) __naked
+{
+  __asm
+    ld    hl, (_g_pBenchSrc)
+    ld    bc, (_g_uiBenchLen)
+    add   hl, bc
+    dec   hl                    ; HL = last byte (backwards)
+    ld    de, (_g_pBenchDst)    ; DE = first byte (forwards)
+    ld    a, 0xE3               ; transparent byte
+    lddrx
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLdi16()                                                               */
+/*----------------------------------------------------------------------------*/
+static void benchLdi16(void) __naked
+{
+  __asm
+    ld    hl, (_g_pBenchSrc)
+    ld    de, (_g_pBenchDst)
+    ld    bc, (_g_uiBenchLen)
+00101$:
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    jp    pe, 00101$            ; until BC = 0
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchPush()                                                                */
+/*----------------------------------------------------------------------------*/
+static void benchPush(void) __naked
+{
+  __asm
+    ld    (_g_uiBenchSp), sp
+    ld    hl, (_g_pBenchDst)
+    ld    bc, (_g_uiBenchLen)
+    add   hl, bc
+    ld    sp, hl                ; SP = end of the target
+    ld    hl, (_g_pBenchSrc)    ; fill with the first word of the source
+    ld    a, (hl)
+    inc   hl
+    ld    h, (hl)
+    ld    l, a
+    ld    a, b
+    add   a, a
+    add   a, a
+    add   a, a                  ; B * 8 = BC / 32 (BC = 256 * n)
+    ld    b, a
+00102$:
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    push  hl
+    djnz  00102$
+    ld    sp, (_g_uiBenchSp)
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLdpirx()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchLdpirx(void) __naked
+{
+  __asm
+    ld    hl, (_g_pBenchSrc)    ; 8 byte pattern (aligned)
+    ld    de, (_g_pBenchDst)
+    ld    bc, (_g_uiBenchLen)
+    ld    a, 0xE3               ; transparent byte
+    ldpirx
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,173 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchCpu.c                                                         |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <errno.h>
+#include <intrinsic.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "bench.h"
+#include "benchCpu.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Test loop with a known number of T-states (BENCHCPU_LOOPT)
+*/
+static void benchCpuLoop(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpCpuBench()                                                             */
+/*----------------------------------------------------------------------------*/
+int dumpCpuBench(void)
+{
+  const benchtiming_t* pTiming = benchTiming();
+  uint32_t auiCycles[BENCH_SPEEDS];
+  uint16_t auiClock[BENCH_SPEEDS];
+
+  intrinsic_di();
+
+  for (uint8_t uiSpeed = 0; uiSpeed < BENCH_SPEEDS; ++uiSpeed)
+  {
+    benchSpeed(uiSpeed);
+    auiClock[uiSpeed]  = benchClock(); /* the requested speed may be capped */
+    auiCycles[uiSpeed] = benchCycles(benchCpuLoop, BENCH_FRAMES);
+  }
+
+  benchSpeed(RTM_28MHZ);
+  intrinsic_ei();
+
+  zheader("CPU CLOCK (%s %u.%03u MHZ)", pTiming->acName, pTiming->uiMaster / 1000, pTiming->uiMaster % 1000);
+  zprintf("SPEED    MHZ     DEV  WAIT\n");
+
+  for (uint8_t uiSpeed = 0; uiSpeed < BENCH_SPEEDS; ++uiSpeed)
+  {
+    const uint32_t uiNominal = auiClock[uiSpeed]; /* kHz */
+    const uint32_t uiMeasured = (0 != auiCycles[uiSpeed] ? auiCycles[uiSpeed] : 1);
+    uint32_t uiReal;
+    uint32_t uiDev;
+    uint32_t uiWait;
+    char_t   cSign = '+';
+
+    /*
+    "benchCycles" counts the T-states of the display timing; the loop needs
+    less of them, if the clock is slower (wait states). The frames themselves
+    are derived from the master clock of the video timing.
+    */
+    uiReal = ((uiNominal * pTiming->uiMaster) / 28000 * BENCHCPU_LOOPT) / uiMeasured;
+
+    if (uiReal >= uiNominal)
+    {
+      uiDev = ((uiReal - uiNominal) * 1000) / uiNominal;
+    }
+    else
+    {
+      uiDev = ((uiNominal - uiReal) * 1000) / uiNominal;
+      cSign = '-';
+    }
+
+    uiWait = (uiMeasured > BENCHCPU_LOOPT ? ((uiMeasured - BENCHCPU_LOOPT) * 100) / BENCHCPU_LOOPM : 0);
+
+    zprintf("%5s %3lu.%03lu %c%2lu.%lu%% %lu.%02lu\n",
+            g_acSpeedNames[uiSpeed],
+            uiReal / 1000, uiReal % 1000,
+            cSign, uiDev / 10, uiDev % 10,
+            uiWait / 100, uiWait % 100);
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchCpuLoop()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchCpuLoop(void) __naked
+{
+  __asm
+    ld    b, 0                  ; 7
+00101$:
+    nop                         ; 256 * 16
+    nop
+    nop
+    nop
+    djnz  00101$                ; 255 * 13 + 8
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
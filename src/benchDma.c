@@ -0,0 +1,287 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchDma.c                                                         |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <errno.h>
+#include <z80.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "bench.h"
+#include "benchDma.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define DUMP_DMANAME "%-7s"
+
+/*!
+DMA commands
+*/
+#define BENCHDMA_DISABLE    (0x83)
+#define BENCHDMA_LOAD       (0xCF)
+#define BENCHDMA_ENABLE     (0x87)
+
+/*!
+WR4: Continuous/burst mode, port B address follows
+*/
+#define BENCHDMA_CONTINUOUS (0xAD)
+#define BENCHDMA_BURST      (0xCD)
+
+/*!
+Buffers in the allocated page (slot 3)
+*/
+#define BENCHDMA_SRC        (0x6000)
+#define BENCHDMA_DST        (0x6800)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Iterations of the status loop during the last transfer in burst mode
+*/
+static uint16_t g_uiBenchPolls;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Kind of transfer
+*/
+typedef struct _benchxfer
+{
+  const char_t* acName;
+  uint16_t      uiPortA;                   /* address or port (source)        */
+  uint8_t       uiWR1;                     /* port A: memory/IO + timing      */
+  uint16_t      uiPortB;                   /* address or port (target)        */
+  uint8_t       uiWR2;                     /* port B: memory/IO + timing      */
+} benchxfer_t;
+
+/*!
+Prescaler and number of bytes of a transfer (< 1 frame)
+*/
+typedef struct _benchrate
+{
+  uint8_t  uiPrescaler;
+  uint16_t uiLen;
+} benchrate_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Program the DMA for a transfer (without starting it)
+*/
+static void benchDmaProgram(const benchxfer_t* pXfer, const benchrate_t* pRate, uint8_t uiMode);
+
+static void benchDmaContinuous(void);
+static void benchDmaBurst(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Transfers: nreg 0x00 is selected for reads from port 0x253B, writes go to the
+nreg select port 0x243B (no side effects)
+*/
+static const benchxfer_t g_tXfers[] =
+{
+  {"MEM>MEM", BENCHDMA_SRC, 0x54, BENCHDMA_DST, 0x50},
+  {"MEM>IO",  BENCHDMA_SRC, 0x54, 0x243B,       0x68},
+  {"IO>MEM",  0x253B,       0x6C, BENCHDMA_DST, 0x50},
+  {0,         0,            0,    0,            0   }
+};
+
+/*!
+Prescalers (0 = off) and length of the transfers
+*/
+static const benchrate_t g_tRates[] =
+{
+  {  0, 1024},
+  { 16,  512},
+  { 64,  128},
+  {255,   32}
+};
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpDmaBench()                                                             */
+/*----------------------------------------------------------------------------*/
+int dumpDmaBench(void)
+{
+  uint8_t uiPage;
+
+  if (PAGE_INVALID == (uiPage = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  zheader("ZXNDMA (B/S, %u MHZ)", benchClock() / 1000);
+
+  for (uint8_t i = 0; 0 != g_tXfers[i].acName; ++i)
+  {
+    for (uint8_t j = 0; j < (sizeof(g_tRates) / sizeof(g_tRates[0])); ++j)
+    {
+      uint32_t uiCycles;
+      uint32_t uiBytes;
+      uint32_t uiCpu;
+
+      /* Continuous: the CPU is halted until the end of the block */
+      (void) pageMap(uiPage);
+      benchDmaProgram(&g_tXfers[i], &g_tRates[j], BENCHDMA_CONTINUOUS);
+      uiCycles = benchCycles(benchDmaContinuous, BENCH_FRAMES);
+      z80_outp(BENCHDMA_PORT, BENCHDMA_DISABLE);
+      pageUnmap();
+
+      uiBytes = (0 != uiCycles ? ((((uint32_t) g_tRates[j].uiLen) * benchClock() * 100) / uiCycles) * 10 : 0);
+      zprintf(DUMP_DMANAME " CONT  %3u = %7lu\n", g_tXfers[i].acName, g_tRates[j].uiPrescaler, uiBytes);
+
+      /* Burst: the CPU polls the status while the DMA runs */
+      (void) pageMap(uiPage);
+      benchDmaProgram(&g_tXfers[i], &g_tRates[j], BENCHDMA_BURST);
+      uiCycles = benchCycles(benchDmaBurst, BENCH_FRAMES);
+      z80_outp(BENCHDMA_PORT, BENCHDMA_DISABLE);
+      pageUnmap();
+
+      uiBytes = (0 != uiCycles ? ((((uint32_t) g_tRates[j].uiLen) * benchClock() * 100) / uiCycles) * 10 : 0);
+      uiCpu   = (0 != uiCycles ? (((uint32_t) g_uiBenchPolls) * BENCHDMA_POLLT * 100) / uiCycles : 0);
+      zprintf(DUMP_DMANAME " BURST %3u = %7lu %3lu%%\n", g_tXfers[i].acName, g_tRates[j].uiPrescaler, uiBytes, (uiCpu > 100 ? 100 : uiCpu));
+    }
+  }
+
+  pageFree(uiPage);
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchDmaProgram()                                                          */
+/*----------------------------------------------------------------------------*/
+static void benchDmaProgram(const benchxfer_t* pXfer, const benchrate_t* pRate, uint8_t uiMode)
+{
+  z80_outp(0x243B, 0x00);                               /* nreg for reads   */
+
+  z80_outp(BENCHDMA_PORT, BENCHDMA_DISABLE);
+  z80_outp(BENCHDMA_PORT, 0x7D);                        /* WR0: A -> B      */
+  z80_outp(BENCHDMA_PORT, (uint8_t) (pXfer->uiPortA));
+  z80_outp(BENCHDMA_PORT, (uint8_t) (pXfer->uiPortA >> 8));
+  z80_outp(BENCHDMA_PORT, (uint8_t) (pRate->uiLen));
+  z80_outp(BENCHDMA_PORT, (uint8_t) (pRate->uiLen >> 8));
+  z80_outp(BENCHDMA_PORT, pXfer->uiWR1);                /* WR1: port A      */
+  z80_outp(BENCHDMA_PORT, 0x02);                        /* 2 cycles         */
+  z80_outp(BENCHDMA_PORT, pXfer->uiWR2);                /* WR2: port B      */
+
+  if (0 != pRate->uiPrescaler)
+  {
+    z80_outp(BENCHDMA_PORT, 0x22);                      /* + prescaler      */
+    z80_outp(BENCHDMA_PORT, pRate->uiPrescaler);
+  }
+  else
+  {
+    z80_outp(BENCHDMA_PORT, 0x02);
+  }
+
+  z80_outp(BENCHDMA_PORT, uiMode);                      /* WR4: mode        */
+  z80_outp(BENCHDMA_PORT, (uint8_t) (pXfer->uiPortB));
+  z80_outp(BENCHDMA_PORT, (uint8_t) (pXfer->uiPortB >> 8));
+  z80_outp(BENCHDMA_PORT, 0x82);                        /* WR5: stop at end */
+  z80_outp(BENCHDMA_PORT, BENCHDMA_LOAD);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchDmaContinuous()                                                       */
+/*----------------------------------------------------------------------------*/
+static void benchDmaContinuous(void) __naked
+{
+  __asm
+    ld    a, 0xCF               ; LOAD
+    out   (0x6B), a
+    ld    a, 0x87               ; ENABLE (CPU waits until the end)
+    out   (0x6B), a
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchDmaBurst()                                                            */
+/*----------------------------------------------------------------------------*/
+static void benchDmaBurst(void) __naked
+{
+  __asm
+    ld    a, 0xCF               ; LOAD
+    out   (0x6B), a
+    ld    a, 0x87               ; ENABLE
+    out   (0x6B), a
+    ld    de, 0
+00101$:
+    inc   de                    ; 54 T-states per iteration
+    ld    a, 0xBF               ; read status byte
+    out   (0x6B), a
+    in    a, (0x6B)
+    and   0x20                  ; 0 = end of block
+    jr    nz, 00101$
+    ld    (_g_uiBenchPolls), de
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,519 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchGfx.c                                                         |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <z80.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "bench.h"
+#include "benchGfx.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define DUMP_GFXNAME "%-3s %-7s"
+
+/*!
+Buffers: source in the allocated page (slot 3), tilemap/tiles in bank 5
+*/
+#define BENCHGFX_SRC    (0x6000)
+#define BENCHGFX_BACKUP (0x7000)
+#define BENCHGFX_BANK5  (0x4000)
+
+/*!
+WR2 of the zxnDMA (port B): IO fixed or memory increment (+ timing)
+*/
+#define BENCHGFX_IO     (0x68)
+#define BENCHGFX_MEMORY (0x50)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Upload under test: selection of the target, primitive and port/address
+*/
+static benchfn_t g_pGfxSetup;
+static benchfn_t g_pGfxFn;
+static uint16_t  g_uiGfxPort;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Upload: target, primitive and size of an entry of the target
+*/
+typedef struct _gfxupload
+{
+  const char_t* acTarget;
+  const char_t* acMethod;
+  benchfn_t     pSetup;                    /* select the target (each call)   */
+  benchfn_t     pFn;                       /* BENCHGFX_LEN bytes              */
+  uint16_t      uiPort;                    /* port or address                 */
+  uint8_t       uiWR2;                     /* BENCHGFX_IO or BENCHGFX_MEMORY  */
+  uint16_t      uiEntry;                   /* bytes of an entry               */
+} gfxupload_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Entries of the target per frame at the current CPU speed
+*/
+static uint32_t benchGfxRun(const gfxupload_t* pUpload);
+
+/*!
+Program the zxnDMA for an upload (without starting it)
+*/
+static void benchGfxDmaProgram(const gfxupload_t* pUpload);
+
+/*!
+Call of the upload under test
+*/
+static void benchGfxCall(void);
+
+/*!
+Selection of the targets
+*/
+static void benchGfxPattern(void);
+static void benchGfxAttribute(void);
+static void benchGfxPalette(void);
+static void benchGfxNone(void);
+
+/*!
+Primitives
+*/
+static void benchGfxOuti(void);
+static void benchGfxOtir(void);
+static void benchGfxOutinb(void);
+static void benchGfxNextreg(void);
+static void benchGfxLdi(void);
+static void benchGfxLdir(void);
+static void benchGfxDma(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Uploads: port 0x253B needs the high byte, so the palette uses OUTINB and
+NEXTREG instead of OUTI/OTIR; tilemap and tiles are plain memory of bank 5.
+*/
+static const gfxupload_t g_tUploads[] =
+{
+  {"PAT", "OUTI",    benchGfxPattern,   benchGfxOuti,    0x005B,         BENCHGFX_IO,     256},
+  {"PAT", "OTIR",    benchGfxPattern,   benchGfxOtir,    0x005B,         BENCHGFX_IO,     256},
+  {"PAT", "DMA",     benchGfxPattern,   benchGfxDma,     0x005B,         BENCHGFX_IO,     256},
+  {"ATR", "OUTI",    benchGfxAttribute, benchGfxOuti,    0x0057,         BENCHGFX_IO,     4  },
+  {"ATR", "OTIR",    benchGfxAttribute, benchGfxOtir,    0x0057,         BENCHGFX_IO,     4  },
+  {"ATR", "DMA",     benchGfxAttribute, benchGfxDma,     0x0057,         BENCHGFX_IO,     4  },
+  {"PAL", "OUTINB",  benchGfxPalette,   benchGfxOutinb,  0x253B,         BENCHGFX_IO,     2  },
+  {"PAL", "NEXTREG", benchGfxPalette,   benchGfxNextreg, 0x253B,         BENCHGFX_IO,     2  },
+  {"PAL", "DMA",     benchGfxPalette,   benchGfxDma,     0x253B,         BENCHGFX_IO,     2  },
+  {"MAP", "LDI*16",  benchGfxNone,      benchGfxLdi,     BENCHGFX_BANK5, BENCHGFX_MEMORY, 2  },
+  {"MAP", "LDIR",    benchGfxNone,      benchGfxLdir,    BENCHGFX_BANK5, BENCHGFX_MEMORY, 2  },
+  {"MAP", "DMA",     benchGfxNone,      benchGfxDma,     BENCHGFX_BANK5, BENCHGFX_MEMORY, 2  },
+  {"TIL", "LDI*16",  benchGfxNone,      benchGfxLdi,     BENCHGFX_BANK5, BENCHGFX_MEMORY, 32 },
+  {"TIL", "LDIR",    benchGfxNone,      benchGfxLdir,    BENCHGFX_BANK5, BENCHGFX_MEMORY, 32 },
+  {"TIL", "DMA",     benchGfxNone,      benchGfxDma,     BENCHGFX_BANK5, BENCHGFX_MEMORY, 32 },
+  {0,     0,         0,                 0,               0,              0,               0  }
+};
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpGfxBench()                                                             */
+/*----------------------------------------------------------------------------*/
+int dumpGfxBench(void)
+{
+  static uint32_t auiResult[BENCH_SPEEDS][sizeof(g_tUploads) / sizeof(g_tUploads[0])];
+  uint8_t uiPage;
+  uint8_t uiPalCtrl;
+  uint8_t uiPalIndex;
+
+  if (PAGE_INVALID == (uiPage = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  /* Palette uploads go to the second tilemap palette with auto increment */
+  uiPalCtrl  = ZXN_READ_REG(0x43);
+  uiPalIndex = ZXN_READ_REG(0x40);
+  ZXN_WRITE_REG(0x43, (uiPalCtrl & 0x0F) | 0x70);
+
+  for (uint8_t uiSpeed = 0; uiSpeed < BENCH_SPEEDS; ++uiSpeed)
+  {
+    benchSpeed(uiSpeed);
+
+    for (uint8_t i = 0; 0 != g_tUploads[i].acTarget; ++i)
+    {
+      (void) pageMap(uiPage);
+      memset((void*) BENCHGFX_SRC, 0, BENCHGFX_LEN); /* hidden sprites, black */
+      auiResult[uiSpeed][i] = benchGfxRun(&g_tUploads[i]);
+      pageUnmap();
+    }
+  }
+
+  benchSpeed(RTM_28MHZ);
+  z80_outp(0x6B, 0x83);                                 /* DMA disable      */
+
+  ZXN_WRITE_REG(0x43, uiPalCtrl);
+  ZXN_WRITE_REG(0x40, uiPalIndex);
+
+  pageFree(uiPage);
+
+  zheader("VIDEO UPLOAD (ENTRIES/FRAME)");
+
+  for (uint8_t uiSpeed = 0; uiSpeed < BENCH_SPEEDS; ++uiSpeed)
+  {
+    zprintf("CPU %s MHZ\n", g_acSpeedNames[uiSpeed]);
+
+    for (uint8_t i = 0; 0 != g_tUploads[i].acTarget; ++i)
+    {
+      zprintf(DUMP_GFXNAME " = %6lu\n", g_tUploads[i].acTarget, g_tUploads[i].acMethod, auiResult[uiSpeed][i]);
+    }
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxRun()                                                              */
+/*----------------------------------------------------------------------------*/
+static uint32_t benchGfxRun(const gfxupload_t* pUpload)
+{
+  uint32_t uiCycles;
+  uint32_t uiFrame;
+
+  g_pGfxSetup = pUpload->pSetup;
+  g_pGfxFn    = pUpload->pFn;
+  g_uiGfxPort = pUpload->uiPort;
+
+  if (BENCHGFX_MEMORY == pUpload->uiWR2)
+  {
+    memcpy((void*) BENCHGFX_BACKUP, (void*) pUpload->uiPort, BENCHGFX_LEN);
+  }
+
+  if (benchGfxDma == pUpload->pFn)
+  {
+    benchGfxDmaProgram(pUpload);
+  }
+
+  uiCycles = benchCycles(benchGfxCall, BENCH_FRAMES);
+
+  if (BENCHGFX_MEMORY == pUpload->uiWR2)
+  {
+    memcpy((void*) pUpload->uiPort, (void*) BENCHGFX_BACKUP, BENCHGFX_LEN);
+  }
+
+  /* T-states of a frame / T-states of an upload * entries of an upload */
+  uiFrame = benchFrameCycles();
+
+  return (0 != uiCycles ? (uiFrame * (BENCHGFX_LEN / pUpload->uiEntry)) / uiCycles : 0);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxDmaProgram()                                                       */
+/*----------------------------------------------------------------------------*/
+static void benchGfxDmaProgram(const gfxupload_t* pUpload)
+{
+  z80_outp(0x6B, 0x83);                                 /* disable          */
+  z80_outp(0x6B, 0x7D);                                 /* WR0: A -> B      */
+  z80_outp(0x6B, (uint8_t) (BENCHGFX_SRC));
+  z80_outp(0x6B, (uint8_t) (BENCHGFX_SRC >> 8));
+  z80_outp(0x6B, (uint8_t) (BENCHGFX_LEN));
+  z80_outp(0x6B, (uint8_t) (BENCHGFX_LEN >> 8));
+  z80_outp(0x6B, 0x54);                                 /* WR1: memory, inc */
+  z80_outp(0x6B, 0x02);                                 /* 2 cycles         */
+  z80_outp(0x6B, pUpload->uiWR2);                       /* WR2: port B      */
+  z80_outp(0x6B, 0x02);
+  z80_outp(0x6B, 0xAD);                                 /* WR4: continuous  */
+  z80_outp(0x6B, (uint8_t) (pUpload->uiPort));
+  z80_outp(0x6B, (uint8_t) (pUpload->uiPort >> 8));
+  z80_outp(0x6B, 0x82);                                 /* WR5: stop at end */
+  z80_outp(0x6B, 0xCF);                                 /* load             */
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxCall()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchGfxCall(void)
+{
+  g_pGfxSetup();
+  g_pGfxFn();
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxPattern()                                                          */
+/*----------------------------------------------------------------------------*/
+static void benchGfxPattern(void) __naked
+{
+  __asm
+    ld    bc, 0x303B            ; sprite slot: pattern 63
+    ld    a, 63
+    out   (c), a
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxAttribute()                                                        */
+/*----------------------------------------------------------------------------*/
+static void benchGfxAttribute(void) __naked
+{
+  __asm
+    ld    bc, 0x303B            ; sprite slot: attributes of sprite 64-127
+    ld    a, 64
+    out   (c), a
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxPalette()                                                          */
+/*----------------------------------------------------------------------------*/
+static void benchGfxPalette(void) __naked
+{
+  __asm
+    nextreg 0x40, 0             ; palette index 0
+    ld    bc, 0x243B            ; select NR 0x44 for port 0x253B
+    ld    a, 0x44
+    out   (c), a
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxNone()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchGfxNone(void)
+{
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxOuti()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchGfxOuti(void) __naked
+{
+  __asm
+    ld    hl, 0x6000            ; BENCHGFX_SRC
+    ld    bc, (_g_uiGfxPort)    ; sprite ports decode the low byte only
+    ld    d, 16
+00101$:
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    outi
+    dec   d
+    jr    nz, 00101$
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxOtir()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchGfxOtir(void) __naked
+{
+  __asm
+    ld    hl, 0x6000            ; BENCHGFX_SRC
+    ld    bc, (_g_uiGfxPort)
+    ld    b, 0                  ; 256 bytes
+    otir
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxOutinb()                                                           */
+/*----------------------------------------------------------------------------*/
+static void benchGfxOutinb(void) __naked
+{
+  __asm
+    ld    hl, 0x6000            ; BENCHGFX_SRC
+    ld    bc, (_g_uiGfxPort)    ; B is not changed by OUTINB
+    ld    d, 16
+00101$:
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    outinb
+    dec   d
+    jr    nz, 00101$
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxNextreg()                                                          */
+/*----------------------------------------------------------------------------*/
+static void benchGfxNextreg(void) __naked
+{
+  __asm
+    ld    hl, 0x6000            ; BENCHGFX_SRC
+    ld    b, 0                  ; 256 bytes
+00101$:
+    ld    a, (hl)
+    inc   hl
+    nextreg 0x44, a
+    djnz  00101$
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxLdi()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchGfxLdi(void) __naked
+{
+  __asm
+    ld    hl, 0x6000            ; BENCHGFX_SRC
+    ld    de, (_g_uiGfxPort)
+    ld    a, 16
+00101$:
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    dec   a
+    jr    nz, 00101$
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxLdir()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchGfxLdir(void) __naked
+{
+  __asm
+    ld    hl, 0x6000            ; BENCHGFX_SRC
+    ld    de, (_g_uiGfxPort)
+    ld    bc, 256               ; BENCHGFX_LEN
+    ldir
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchGfxDma()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchGfxDma(void) __naked
+{
+  __asm
+    ld    bc, 0x006B
+    ld    a, 0xCF               ; load
+    out   (c), a
+    ld    a, 0x87               ; enable: the CPU is halted until the end
+    out   (c), a
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,665 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchLat.c                                                         |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <z80.h>
+#include <intrinsic.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "raster.h"
+#include "bench.h"
+#include "benchLat.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+IM2 vector table (257 x 0x61) and jump to the handler in the allocated page
+(slot 3, I = 0x60)
+*/
+#define BENCHLAT_TABLE   (0x6000)
+#define BENCHLAT_JUMP    (0x6161)
+
+/*!
+Port of a CTC channel
+*/
+#define BENCHLAT_CTC(n)  (0x183B + ((n) << 8))
+
+/*!
+Marker of a run without enough interrupts
+*/
+#define BENCHLAT_INVALID (0xFFFF)
+
+/*!
+Maximum latency shown in CTC ticks (9987 T)
+*/
+#define BENCHLAT_MAXT    (623)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Time stamp taken by the handler: high byte, low byte, high byte again
+*/
+typedef struct _latsample
+{
+  uint8_t uiLo;
+  uint8_t uiHi;
+  uint8_t uiHi2;
+} latsample_t;
+
+/*!
+Source of the interrupt
+*/
+typedef struct _latsource
+{
+  const char_t* acName;
+  uint8_t       uiNr22;                    /* ULA/line interrupt control      */
+  uint8_t       uiNrC4;                    /* INT enable 0                    */
+  uint8_t       uiNrC5;                    /* INT enable 1 (CTC)              */
+  uint16_t      uiPort;                    /* port of the time stamp          */
+} latsource_t;
+
+/*!
+Load of the CPU while waiting for the interrupt
+*/
+typedef struct _latload
+{
+  const char_t* acName;
+  benchfn_t     pFn;
+} latload_t;
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Time stamps, written by the handler "benchLatIrq"
+*/
+static latsample_t g_tLatSamples[BENCHLAT_TOTAL];
+static latsample_t* g_pLatNext;
+static volatile uint8_t g_uiLatCount;
+static uint16_t g_uiLatPort;
+
+/*!
+Unwrapped time stamps (CTC ticks)
+*/
+static uint32_t g_auiLatTime[BENCHLAT_TOTAL];
+
+/*!
+Interrupt vector register of NextZXOS
+*/
+static uint8_t g_uiLatI;
+
+/*!
+Saved nregs (see "g_auiLatRegs")
+*/
+static uint8_t g_auiLatSaved[6];
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Run the measurement of one source/mode/load
+@return Number of time stamps
+*/
+static uint8_t benchLatRun(const latsource_t* pSource, uint8_t uiMode, benchfn_t pLoad);
+
+/*!
+Calculate minimum, median, 95th percentile and maximum of the latency and the
+number of lost interrupts
+@param pSource Source of the interrupt
+@param uiCount Number of time stamps
+@param pResult Result (5 values, BENCHLAT_INVALID)
+*/
+static void benchLatEval(const latsource_t* pSource, uint8_t uiCount, uint16_t* pResult);
+
+/*!
+Time stamp (rising CTC ticks) of a sample
+*/
+static uint16_t benchLatTime(const latsample_t* pSample);
+
+/*!
+Program the zxnDMA for the DMA load
+*/
+static void benchLatDmaProgram(void);
+
+/*!
+Interrupt handler, time stamp and IM2 mode
+*/
+static void benchLatIrq(void);
+static uint8_t benchLatGetI(void);
+static void benchLatIm2(void);
+static void benchLatIm1(void);
+
+/*!
+Loads (one unit of work per call)
+*/
+static void benchLatIdle(void);
+static void benchLatLdir(void);
+static void benchLatDma(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Nregs that are changed by the measurement
+*/
+static const uint8_t g_auiLatRegs[6] = {0xC0, 0xC4, 0xC5, 0xC6, 0x22, 0x23};
+
+/*!
+Sources: the ULA and line interrupt are time stamped by the stopwatch in
+CTC channel 1/2, the CTC interrupt by its own down counter (channel 0).
+*/
+static const latsource_t g_tSources[] =
+{
+  {"ULA", 0x00, 0x01, 0x00, BENCHLAT_CTC(1)},
+  {"LIN", 0x06, 0x02, 0x00, BENCHLAT_CTC(1)},
+  {"CTC", 0x04, 0x00, 0x01, BENCHLAT_CTC(0)},
+  {0,     0,    0,    0,    0              }
+};
+
+/*!
+Names of the modes: legacy (pulse) and hardware IM2 mode (NR 0xC0 bit 0)
+*/
+static const char_t* g_acModeNames[2] = {"SW", "HW"};
+
+/*!
+Loads
+*/
+static const latload_t g_tLoads[] =
+{
+  {"IDLE", benchLatIdle},
+  {"LDIR", benchLatLdir},
+  {"DMA",  benchLatDma },
+  {0,      0           }
+};
+
+/*!
+zxnDMA: 512 bytes memory to memory (0x6400 -> 0x6800), continuous mode
+*/
+static const uint8_t g_auiLatDma[] =
+{
+  0x83,                                    /* disable                         */
+  0x7D, 0x00, 0x64, 0x00, 0x02,            /* WR0: A -> B, address, length    */
+  0x54, 0x02,                              /* WR1: memory, increment          */
+  0x50, 0x02,                              /* WR2: memory, increment          */
+  0xAD, 0x00, 0x68,                        /* WR4: continuous, address B      */
+  0x82,                                    /* WR5: stop at end                */
+  0xCF                                     /* load                            */
+};
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpLatencyBench()                                                         */
+/*----------------------------------------------------------------------------*/
+int dumpLatencyBench(void)
+{
+  static uint16_t auiResult[sizeof(g_tSources) / sizeof(g_tSources[0])][2][sizeof(g_tLoads) / sizeof(g_tLoads[0])][5];
+  uint8_t* pJump = (uint8_t*) BENCHLAT_JUMP;
+  uint8_t  uiPage;
+
+  if (PAGE_INVALID == (uiPage = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  /* IM2 table: each vector points to 0x6161 (legacy and hardware IM2) */
+  memset(pageMap(uiPage), 0x61, 257);
+  pJump[0] = 0xC3;                                      /* JP benchLatIrq   */
+  *((uint16_t*) &pJump[1]) = (uint16_t) benchLatIrq;
+
+  benchSpeed(RTM_28MHZ);
+  g_uiLatI = benchLatGetI();
+
+  for (uint8_t i = 0; i < sizeof(g_auiLatRegs); ++i)
+  {
+    g_auiLatSaved[i] = ZXN_READ_REG(g_auiLatRegs[i]);
+  }
+
+  for (uint8_t i = 0; 0 != g_tSources[i].acName; ++i)
+  {
+    for (uint8_t uiMode = 0; uiMode < 2; ++uiMode)
+    {
+      for (uint8_t j = 0; 0 != g_tLoads[j].acName; ++j)
+      {
+        const uint8_t uiCount = benchLatRun(&g_tSources[i], uiMode, g_tLoads[j].pFn);
+        benchLatEval(&g_tSources[i], uiCount, auiResult[i][uiMode][j]);
+      }
+    }
+  }
+
+  for (uint8_t i = 0; i < sizeof(g_auiLatRegs); ++i)
+  {
+    ZXN_WRITE_REG(g_auiLatRegs[i], g_auiLatSaved[i]);   /* 0x22 after 0xC4 */
+  }
+
+  benchLatIm1();
+  pageUnmap();
+  pageFree(uiPage);
+
+  zheader("INTERRUPT LATENCY (T, 28 MHZ)");
+  zprintf("             MIN  P50  P95  MAX\n");
+
+  for (uint8_t i = 0; 0 != g_tSources[i].acName; ++i)
+  {
+    for (uint8_t uiMode = 0; uiMode < 2; ++uiMode)
+    {
+      for (uint8_t j = 0; 0 != g_tLoads[j].acName; ++j)
+      {
+        const uint16_t* pResult = auiResult[i][uiMode][j];
+
+        zprintf("%s %s %-4s", g_tSources[i].acName, g_acModeNames[uiMode], g_tLoads[j].acName);
+
+        if (BENCHLAT_INVALID == pResult[0])
+        {
+          zprintf("   --   --   --   --\n");
+        }
+        else
+        {
+          zprintf(" %4u %4u %4u %4u\n", pResult[0], pResult[1], pResult[2], pResult[3]);
+        }
+      }
+    }
+  }
+
+  /* Frames without interrupt (e.g. pulse missed while the DMA holds the bus) */
+  for (uint8_t i = 0; 0 != g_tSources[i].acName; ++i)
+  {
+    for (uint8_t uiMode = 0; uiMode < 2; ++uiMode)
+    {
+      for (uint8_t j = 0; 0 != g_tLoads[j].acName; ++j)
+      {
+        const uint16_t* pResult = auiResult[i][uiMode][j];
+
+        if ((BENCHLAT_INVALID != pResult[0]) && (0 != pResult[4]))
+        {
+          zprintf("%s %s %-4s LOST %u\n", g_tSources[i].acName, g_acModeNames[uiMode], g_tLoads[j].acName, pResult[4]);
+        }
+      }
+    }
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatRun()                                                              */
+/*----------------------------------------------------------------------------*/
+static uint8_t benchLatRun(const latsource_t* pSource, uint8_t uiMode, benchfn_t pLoad)
+{
+  uint16_t uiLast = rasterLine();
+  uint16_t uiLine;
+  uint8_t  uiFrames = 0;
+
+  g_uiLatCount = 0;
+  g_pLatNext   = g_tLatSamples;
+  g_uiLatPort  = pSource->uiPort;
+
+  ZXN_WRITE_REG(0xC0, (g_auiLatSaved[0] & 0xFE) | uiMode);
+  ZXN_WRITE_REG(0xC6, 0x00);                            /* no UART          */
+
+  /* Stopwatch: channel 1 = timer (prescaler 16), channel 2 counts its ZC/TO */
+  z80_outp(BENCHLAT_CTC(1), 0x05);
+  z80_outp(BENCHLAT_CTC(1), 0x00);
+  z80_outp(BENCHLAT_CTC(2), 0x45);
+  z80_outp(BENCHLAT_CTC(2), 0x00);
+
+  if (0 != pSource->uiNrC5)
+  {
+    z80_outp(BENCHLAT_CTC(0), 0x85);                    /* timer, interrupt */
+    z80_outp(BENCHLAT_CTC(0), BENCHLAT_CTCTC);
+  }
+
+  ZXN_WRITE_REG(0xC5, pSource->uiNrC5);
+  ZXN_WRITE_REG(0xC4, pSource->uiNrC4);
+  ZXN_WRITE_REG(0x23, BENCHLAT_LINE);
+  ZXN_WRITE_REG(0x22, pSource->uiNr22);
+
+  ZXN_WRITE_REG(0xC8, 0xFF);
+  ZXN_WRITE_REG(0xC9, 0xFF);
+  ZXN_WRITE_REG(0xCA, 0xFF);
+
+  if (benchLatDma == pLoad)
+  {
+    benchLatDmaProgram();
+  }
+
+  benchLatIm2();
+
+  while ((BENCHLAT_TOTAL > g_uiLatCount) && (BENCHLAT_TIMEOUT > uiFrames))
+  {
+    const benchfn_t pFn = (BENCHLAT_CALIB > g_uiLatCount ? benchLatIdle : pLoad);
+
+    pFn();
+
+    if ((uiLine = rasterLine()) < uiLast)
+    {
+      ++uiFrames;
+    }
+    uiLast = uiLine;
+  }
+
+  intrinsic_di();
+
+  ZXN_WRITE_REG(0x22, 0x04);                            /* ULA off          */
+  ZXN_WRITE_REG(0xC4, 0x00);
+  ZXN_WRITE_REG(0xC5, 0x00);
+
+  for (uint8_t i = 0; i < 3; ++i)
+  {
+    z80_outp(BENCHLAT_CTC(i), 0x03);                    /* reset            */
+  }
+
+  z80_outp(0x6B, 0x83);                                 /* DMA disable      */
+
+  return g_uiLatCount;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatEval()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchLatEval(const latsource_t* pSource, uint8_t uiCount, uint16_t* pResult)
+{
+  uint16_t auiLat[BENCHLAT_SAMPLES];
+
+  pResult[4] = 0;
+
+  if (BENCHLAT_TOTAL > uiCount)
+  {
+    pResult[0] = BENCHLAT_INVALID;
+    return;
+  }
+
+  if (0 != pSource->uiNrC5)
+  {
+    /* CTC: ticks since the zero count of the channel itself */
+    for (uint8_t i = 0; i < BENCHLAT_SAMPLES; ++i)
+    {
+      const uint8_t  uiLo = g_tLatSamples[BENCHLAT_CALIB + i].uiLo;
+      const uint16_t uiT  = (BENCHLAT_CTCTC > uiLo ? ((uint16_t) (BENCHLAT_CTCTC - uiLo)) << 4 : 0);
+
+      auiLat[i] = (uiT > BENCHLAT_ENTRYT ? uiT - BENCHLAT_ENTRYT : 0);
+    }
+  }
+  else
+  {
+    /*
+    ULA/line: the interrupts are asserted once per frame. The period is
+    calibrated with the idle samples; the latency is the distance to the
+    earliest idle sample, which is taken as best case (IM2 acknowledge).
+    The frame of a sample is derived from its time, not from its index, so
+    lost interrupts (pulse mode while the DMA holds the bus) don't shift the
+    later samples by a whole period; they are counted instead.
+    */
+    uint16_t uiPrev = benchLatTime(&g_tLatSamples[0]);
+    uint32_t uiPeriod;
+    int32_t  iBase = INT32_MAX;
+    uint32_t uiFrame;
+    uint32_t uiLast = BENCHLAT_CALIB - 1;
+
+    g_auiLatTime[0] = 0;
+
+    for (uint8_t i = 1; i < BENCHLAT_TOTAL; ++i)
+    {
+      const uint16_t uiTime = benchLatTime(&g_tLatSamples[i]);
+
+      g_auiLatTime[i] = g_auiLatTime[i - 1] + (uint16_t) (uiTime - uiPrev);
+      uiPrev = uiTime;
+    }
+
+    uiPeriod = (g_auiLatTime[BENCHLAT_CALIB - 1] + ((BENCHLAT_CALIB - 1) / 2)) / (BENCHLAT_CALIB - 1);
+
+    for (uint8_t i = 0; i < BENCHLAT_CALIB; ++i)
+    {
+      const int32_t iPhase = (int32_t) (g_auiLatTime[i] - (i * uiPeriod));
+      iBase = (iPhase < iBase ? iPhase : iBase);
+    }
+
+    for (uint8_t i = 0; i < BENCHLAT_SAMPLES; ++i)
+    {
+      int32_t iPhase = ((int32_t) g_auiLatTime[BENCHLAT_CALIB + i]) - iBase;
+
+      uiFrame = (0 < iPhase ? (((uint32_t) iPhase) + (uiPeriod / 2)) / uiPeriod : 0);
+      iPhase -= (int32_t) (uiFrame * uiPeriod);
+
+      if (uiFrame > uiLast + 1)
+      {
+        pResult[4] += (uint16_t) (uiFrame - uiLast - 1);
+      }
+      uiLast = uiFrame;
+
+      iPhase = (0 > iPhase ? 0 : (BENCHLAT_MAXT < iPhase ? BENCHLAT_MAXT : iPhase));
+      auiLat[i] = ((uint16_t) iPhase << 4) + BENCHLAT_ACKT;
+    }
+  }
+
+  benchSort(auiLat, BENCHLAT_SAMPLES);
+
+  pResult[0] = benchPercentile(auiLat, BENCHLAT_SAMPLES, 0);
+  pResult[1] = benchPercentile(auiLat, BENCHLAT_SAMPLES, 50);
+  pResult[2] = benchPercentile(auiLat, BENCHLAT_SAMPLES, 95);
+  pResult[3] = benchPercentile(auiLat, BENCHLAT_SAMPLES, 100);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatTime()                                                             */
+/*----------------------------------------------------------------------------*/
+static uint16_t benchLatTime(const latsample_t* pSample)
+{
+  uint8_t uiHi = pSample->uiHi;
+
+  if ((pSample->uiHi != pSample->uiHi2) && (128 <= pSample->uiLo))
+  {
+    uiHi = pSample->uiHi2; /* channel 1 reloaded before the low byte was read */
+  }
+
+  return ~((((uint16_t) uiHi) << 8) | pSample->uiLo); /* down -> up */
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatDmaProgram()                                                       */
+/*----------------------------------------------------------------------------*/
+static void benchLatDmaProgram(void)
+{
+  for (uint8_t i = 0; i < sizeof(g_auiLatDma); ++i)
+  {
+    z80_outp(0x6B, g_auiLatDma[i]);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatIrq()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchLatIrq(void) __naked
+{
+  __asm
+    push  af                    ; BENCHLAT_ENTRYT up to the low byte
+    push  bc
+    push  de
+    push  hl
+    ld    bc, (_g_uiLatPort)
+    inc   b
+    in    d, (c)                ; high byte
+    dec   b
+    in    e, (c)                ; low byte = time stamp
+    inc   b
+    in    a, (c)                ; high byte again
+    ld    c, a
+    ld    a, (_g_uiLatCount)
+    cp    40                    ; BENCHLAT_TOTAL
+    jr    nc, 00101$
+    inc   a
+    ld    (_g_uiLatCount), a
+    ld    hl, (_g_pLatNext)
+    ld    (hl), e
+    inc   hl
+    ld    (hl), d
+    inc   hl
+    ld    (hl), c
+    inc   hl
+    ld    (_g_pLatNext), hl
+00101$:
+    nextreg 0xC8, 0xFF          ; clear the status
+    nextreg 0xC9, 0xFF
+    nextreg 0xCA, 0xFF
+    pop   hl
+    pop   de
+    pop   bc
+    pop   af
+    ei
+    reti
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatGetI()                                                             */
+/*----------------------------------------------------------------------------*/
+static uint8_t benchLatGetI(void) __naked
+{
+  __asm
+    ld    a, i
+    ld    l, a
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatIm2()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchLatIm2(void) __naked
+{
+  __asm
+    ld    a, 0x60               ; BENCHLAT_TABLE
+    ld    i, a
+    im    2
+    ei
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatIm1()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchLatIm1(void) __naked
+{
+  __asm
+    ld    a, (_g_uiLatI)
+    ld    i, a
+    im    1
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatIdle()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchLatIdle(void) __naked
+{
+  __asm
+    ld    b, 32
+00101$:
+    djnz  00101$
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatLdir()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchLatLdir(void) __naked
+{
+  __asm
+    ld    hl, 0x6400
+    ld    de, 0x6800
+    ld    bc, 1024
+    ldir
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchLatDma()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchLatDma(void) __naked
+{
+  __asm
+    ld    bc, 0x006B
+    ld    a, 0xCF               ; load
+    out   (c), a
+    ld    a, 0x87               ; enable: the CPU is halted until the end
+    out   (c), a
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,378 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchOs.c                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <intrinsic.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "bench.h"
+#include "benchSd.h"
+#include "benchOs.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define DUMP_OSNAME "%-10s"
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+State of the calls: pathnames, handle, drive
+*/
+static char_t* g_acOsCwd;
+static char_t  g_acOsFile[0x10];
+static uint8_t g_hOsFile;
+static uint8_t g_uiOsDrive;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Call under test with optional preparation and cleanup (not measured)
+*/
+typedef struct _oscall
+{
+  const char_t* acName;
+  benchfn_t     pFn;
+  benchfn_t     pPre;
+  benchfn_t     pPost;
+} oscall_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Average stopwatch ticks of a call (x 256)
+*/
+static uint32_t benchOsMeasure(const oscall_t* pCall);
+
+/*!
+Calls
+*/
+static void benchOsNop(void);
+static void benchOsRst8(void);
+static void benchOsDosVersion(void);
+static void benchOsGetDate(void);
+static void benchOsGetFree(void);
+static void benchOsModeGet(void);
+static void benchOsGetCwd(void);
+static void benchOsGetDrv(void);
+static void benchOsSetDrv(void);
+static void benchOsOpen(void);
+static void benchOsClose(void);
+static void benchOsOpenDir(void);
+static void benchOsCloseDir(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Reference: time of the measurement itself
+*/
+static const oscall_t g_tOsNop = {"", benchOsNop, 0, 0};
+
+/*!
+Calls of "dumpOperatingSystem" and "dumpSystemInfo"
+*/
+static const oscall_t g_tOsCalls[] =
+{
+  {"RST8",       benchOsRst8,       0,           0              },
+  {"DOSVERSION", benchOsDosVersion, 0,           0              },
+  {"GETDATE",    benchOsGetDate,    0,           0              },
+  {"GETFREE",    benchOsGetFree,    0,           0              },
+  {"MODE_GET",   benchOsModeGet,    0,           0              },
+  {"GETCWD",     benchOsGetCwd,     0,           0              },
+  {"GETDRV",     benchOsGetDrv,     0,           0              },
+  {"SETDRV",     benchOsSetDrv,     0,           0              },
+  {"F_OPEN",     benchOsOpen,       0,           benchOsClose   },
+  {"F_CLOSE",    benchOsClose,      benchOsOpen, 0              },
+  {"F_OPENDIR",  benchOsOpenDir,    0,           benchOsCloseDir},
+  {0,            0,                 0,           0              }
+};
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpOsBench()                                                              */
+/*----------------------------------------------------------------------------*/
+int dumpOsBench(void)
+{
+  static uint32_t auiResult[sizeof(g_tOsCalls) / sizeof(g_tOsCalls[0])];
+  uint32_t uiNop;
+
+  if (0 == (g_acOsCwd = (char_t*) malloc(ESX_PATHNAME_MAX)))
+  {
+    return ENOMEM;
+  }
+
+  memset(g_acOsCwd, 0, ESX_PATHNAME_MAX);
+  (void) esx_f_getcwd(g_acOsCwd);
+  g_uiOsDrive = esx_m_getdrv();
+
+  /* Scratch file for F_OPEN/F_CLOSE */
+  benchSdPath(g_acOsFile, '\0');
+
+  if (INV_FILE_HND == (g_hOsFile = esx_f_open(g_acOsFile, ESXDOS_MODE_W | ESXDOS_MODE_CT)))
+  {
+    free(g_acOsCwd);
+    return EACCES;
+  }
+
+  esx_f_close(g_hOsFile);
+
+  benchSpeed(RTM_28MHZ);
+  intrinsic_di();
+  benchWatchStart();
+
+  uiNop = benchOsMeasure(&g_tOsNop);
+
+  for (uint8_t i = 0; 0 != g_tOsCalls[i].acName; ++i)
+  {
+    const uint32_t uiTicks = benchOsMeasure(&g_tOsCalls[i]);
+    auiResult[i] = (uiTicks > uiNop ? uiTicks - uiNop : 0);
+  }
+
+  benchWatchStop();
+  intrinsic_ei();
+
+  (void) esx_f_unlink(g_acOsFile);
+  free(g_acOsCwd);
+
+  zheader("OS CALLS (28 MHZ, %u CALLS)", BENCHOS_CALLS);
+
+  for (uint8_t i = 0; 0 != g_tOsCalls[i].acName; ++i)
+  {
+    const uint32_t uiT = (auiResult[i] * BENCHOS_TICKT) / 256;
+
+    zprintf(DUMP_OSNAME " = %6lu T %5lu US\n", g_tOsCalls[i].acName, uiT, uiT / 28);
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsMeasure()                                                           */
+/*----------------------------------------------------------------------------*/
+static uint32_t benchOsMeasure(const oscall_t* pCall)
+{
+  uint32_t uiSum = 0;
+
+  for (uint8_t i = 0; i < BENCHOS_CALLS; ++i)
+  {
+    uint32_t uiStart;
+
+    if (0 != pCall->pPre)
+    {
+      pCall->pPre();
+    }
+
+    uiStart = benchWatchRead();
+    pCall->pFn();
+    uiSum += (benchWatchRead() - uiStart) & 0x00FFFFFF;
+
+    if (0 != pCall->pPost)
+    {
+      pCall->pPost();
+    }
+  }
+
+  return (uiSum * 256) / BENCHOS_CALLS; /* ticks x 256: the calls are shorter than a tick */
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsNop()                                                               */
+/*----------------------------------------------------------------------------*/
+static void benchOsNop(void)
+{
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsRst8()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchOsRst8(void) __naked
+{
+  __asm
+    push  ix                    ; cheapest hook: M_GETSETDRV (get)
+    push  iy
+    xor   a
+    rst   8
+    defb  0x89
+    pop   iy
+    pop   ix
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsDosVersion()                                                        */
+/*----------------------------------------------------------------------------*/
+static void benchOsDosVersion(void)
+{
+  (void) esx_m_dosversion();
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsGetDate()                                                           */
+/*----------------------------------------------------------------------------*/
+static void benchOsGetDate(void)
+{
+  struct dos_tm tRaw;
+  (void) esx_m_getdate(&tRaw);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsGetFree()                                                           */
+/*----------------------------------------------------------------------------*/
+static void benchOsGetFree(void)
+{
+  (void) esx_f_getfree();
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsModeGet()                                                           */
+/*----------------------------------------------------------------------------*/
+static void benchOsModeGet(void)
+{
+  struct esx_mode tMode;
+  (void) esx_ide_mode_get(&tMode);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsGetCwd()                                                            */
+/*----------------------------------------------------------------------------*/
+static void benchOsGetCwd(void)
+{
+  (void) esx_f_getcwd(g_acOsCwd);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsGetDrv()                                                            */
+/*----------------------------------------------------------------------------*/
+static void benchOsGetDrv(void)
+{
+  (void) esx_m_getdrv();
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsSetDrv()                                                            */
+/*----------------------------------------------------------------------------*/
+static void benchOsSetDrv(void)
+{
+  (void) esx_m_setdrv(g_uiOsDrive); /* current drive: no change */
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsOpen()                                                              */
+/*----------------------------------------------------------------------------*/
+static void benchOsOpen(void)
+{
+  g_hOsFile = esx_f_open(g_acOsFile, ESXDOS_MODE_R | ESXDOS_MODE_OE);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsClose()                                                             */
+/*----------------------------------------------------------------------------*/
+static void benchOsClose(void)
+{
+  if (INV_FILE_HND != g_hOsFile)
+  {
+    esx_f_close(g_hOsFile);
+    g_hOsFile = INV_FILE_HND;
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsOpenDir()                                                           */
+/*----------------------------------------------------------------------------*/
+static void benchOsOpenDir(void)
+{
+  g_hOsFile = esx_f_opendir(g_acOsCwd);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchOsCloseDir()                                                          */
+/*----------------------------------------------------------------------------*/
+static void benchOsCloseDir(void)
+{
+  if (INV_FILE_HND != g_hOsFile)
+  {
+    (void) esx_f_closedir(g_hOsFile);
+    g_hOsFile = INV_FILE_HND;
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
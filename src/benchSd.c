@@ -0,0 +1,385 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchSd.c                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "bench.h"
+#include "benchSd.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+KB/s of a number of bytes in a number of stopwatch ticks
+*/
+#define BENCHSD_KBS(b, t) (0 != BENCH_WATCH_US(t) ? (((uint32_t) (b)) * 977) / BENCH_WATCH_US(t) : 0)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Sector streaming: fragments of the scratch file, current fragment, flags of
+the card and handle of the file
+*/
+static benchsdmap_t  g_tSdMap[BENCHSD_MAPS];
+static benchsdmap_t* g_pSdEntry;
+static uint8_t       g_uiSdFlags;
+static uint8_t       g_hSdFile;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Write or read the scratch file in blocks (including open/close)
+@return Stopwatch ticks (0 = error)
+*/
+static uint32_t benchSdFile(const char_t* acPath, uint8_t* pBuffer, uint16_t uiSize, uint16_t uiCount, bool bWrite);
+
+/*!
+Read the scratch file by sector streaming
+@param pBytes Number of bytes streamed
+@return Stopwatch ticks (0 = error)
+*/
+static uint32_t benchSdStream(const char_t* acPath, uint32_t* pBytes);
+
+/*!
+DISK_FILEMAP of "g_hSdFile" into "g_tSdMap"
+@return Address behind the last fragment (0 = error)
+*/
+static uint16_t benchSdFilemap(void);
+
+/*!
+Stream the sectors of the fragment "g_pSdEntry" into the mapped page. The
+wait for the start token of a sector is limited (16 x 65536 polls).
+@return 0 = "no error"; 1 = "stream failed or card didn't answer"
+*/
+static uint8_t benchSdStreamRun(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Block sizes (the largest block is the allocated page)
+*/
+static const uint16_t g_auiSdSizes[] = {1, 16, 128, 512, 2048, PAGE_SIZE};
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpSdBench()                                                              */
+/*----------------------------------------------------------------------------*/
+int dumpSdBench(char_t cDrive)
+{
+  static uint32_t auiResult[sizeof(g_auiSdSizes) / sizeof(g_auiSdSizes[0])][2];
+  char_t   acPath[0x10];
+  uint8_t  uiPage;
+  uint8_t* pBuffer;
+  uint32_t uiBytes;
+  uint32_t uiTicks;
+  uint32_t uiStream = 0;
+  int      iReturn = EOK;
+
+  benchSdPath(acPath, cDrive);
+
+  if (PAGE_INVALID == (uiPage = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  pBuffer = pageMap(uiPage);
+  memset(pBuffer, 0xE5, PAGE_SIZE);
+
+  for (uint8_t i = 0; (EOK == iReturn) && (i < (sizeof(g_auiSdSizes) / sizeof(g_auiSdSizes[0]))); ++i)
+  {
+    const uint16_t uiSize  = g_auiSdSizes[i];
+    const uint16_t uiCount = (BENCHSD_COUNT < (BENCHSD_TOTAL / uiSize) ? BENCHSD_COUNT : (BENCHSD_TOTAL / uiSize));
+
+    uiBytes = ((uint32_t) uiSize) * uiCount;
+
+    for (uint8_t j = 0; j < 2; ++j)
+    {
+      if (0 == (uiTicks = benchSdFile(acPath, pBuffer, uiSize, uiCount, 0 == j)))
+      {
+        iReturn = EACCES;
+        break;
+      }
+
+      auiResult[i][j] = BENCHSD_KBS(uiBytes, uiTicks);
+    }
+  }
+
+  /* The scratch file has its full size after the last block size */
+  if ((EOK == iReturn) && (0 != (uiTicks = benchSdStream(acPath, &uiBytes))))
+  {
+    uiStream = BENCHSD_KBS(uiBytes, uiTicks);
+  }
+
+  (void) esx_f_unlink(acPath);
+
+  pageUnmap();
+  pageFree(uiPage);
+
+  if (EOK != iReturn)
+  {
+    return iReturn;
+  }
+
+  zheader("SD SEQUENTIAL (KB/S, %s)", acPath);
+  zprintf("BLOCK   WRITE    READ\n");
+
+  for (uint8_t i = 0; i < (sizeof(g_auiSdSizes) / sizeof(g_auiSdSizes[0])); ++i)
+  {
+    zprintf("%5u %7lu %7lu\n", g_auiSdSizes[i], auiResult[i][0], auiResult[i][1]);
+  }
+
+  zprintf("%-5s %7s %7lu\n", "SECT", "-", uiStream);
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdPath()                                                              */
+/*----------------------------------------------------------------------------*/
+void benchSdPath(char_t* acPath, char_t cDrive)
+{
+  if ('\0' != cDrive)
+  {
+    sprintf(acPath, "%c:" BENCHSD_FILE, cDrive);
+  }
+  else
+  {
+    strcpy(acPath, BENCHSD_FILE);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdFile()                                                              */
+/*----------------------------------------------------------------------------*/
+static uint32_t benchSdFile(const char_t* acPath, uint8_t* pBuffer, uint16_t uiSize, uint16_t uiCount, bool bWrite)
+{
+  uint32_t uiTicks;
+  uint8_t  hFile;
+  bool     bOk = true;
+
+  if (INV_FILE_HND == (hFile = esx_f_open(acPath, bWrite ? (ESXDOS_MODE_W | ESXDOS_MODE_CT) : (ESXDOS_MODE_R | ESXDOS_MODE_OE))))
+  {
+    return 0;
+  }
+
+  benchWatchStart();
+
+  while (bOk && (0 != uiCount--))
+  {
+    bOk = (uiSize == (bWrite ? esx_f_write(hFile, pBuffer, uiSize) : esx_f_read(hFile, pBuffer, uiSize)));
+  }
+
+  esx_f_close(hFile); /* the data are flushed */
+
+  uiTicks = benchWatchRead();
+  benchWatchStop();
+
+  return (bOk ? (0 != uiTicks ? uiTicks : 1) : 0);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdStream()                                                            */
+/*----------------------------------------------------------------------------*/
+static uint32_t benchSdStream(const char_t* acPath, uint32_t* pBytes)
+{
+  uint32_t uiTicks = 0;
+  uint16_t uiEnd;
+
+  *pBytes = 0;
+
+  if (INV_FILE_HND == (g_hSdFile = esx_f_open(acPath, ESXDOS_MODE_R | ESXDOS_MODE_OE)))
+  {
+    return 0;
+  }
+
+  if (0 != (uiEnd = benchSdFilemap()))
+  {
+    benchWatchStart();
+
+    for (g_pSdEntry = g_tSdMap; ((uint16_t) g_pSdEntry) < uiEnd; ++g_pSdEntry)
+    {
+      if (0 != benchSdStreamRun())
+      {
+        *pBytes = 0;
+        break;
+      }
+
+      *pBytes += ((uint32_t) g_pSdEntry->uiSectors) * 512;
+    }
+
+    uiTicks = benchWatchRead();
+    benchWatchStop();
+  }
+
+  esx_f_close(g_hSdFile);
+
+  return (0 != *pBytes ? (0 != uiTicks ? uiTicks : 1) : 0);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdFilemap()                                                           */
+/*----------------------------------------------------------------------------*/
+static uint16_t benchSdFilemap(void) __naked
+{
+  __asm
+    push  ix
+    ld    a, (_g_hSdFile)
+    ld    hl, _g_tSdMap         ; HL = buffer (dot command)
+    ld    de, 8                 ; BENCHSD_MAPS
+    rst   8
+    defb  0x85                  ; DISK_FILEMAP
+    jr    c, 00101$
+    ld    (_g_uiSdFlags), a     ; HL = behind the last fragment
+    pop   ix
+    ret
+00101$:
+    ld    hl, 0
+    pop   ix
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdStreamRun()                                                         */
+/*----------------------------------------------------------------------------*/
+static uint8_t benchSdStreamRun(void) __naked
+{
+  __asm
+    push  ix
+    ld    hl, (_g_pSdEntry)
+    ld    e, (hl)               ; IXDE = card address
+    inc   hl
+    ld    d, (hl)
+    inc   hl
+    ld    c, (hl)
+    inc   hl
+    ld    b, (hl)
+    inc   hl
+    push  bc
+    pop   ix
+    ld    c, (hl)               ; BC = sectors
+    inc   hl
+    ld    b, (hl)
+    push  bc
+    ld    a, (_g_uiSdFlags)
+    rst   8
+    defb  0x86                  ; DISK_STRMSTART
+    pop   de                    ; DE = sectors
+    jr    c, 00109$
+    ld    c, 0xEB               ; data port of the card
+00101$:
+    ld    hl, 0                 ; timeout: 16 x 65536 polls
+    ld    b, 16
+00102$:
+    in    a, (c)                ; wait for the start token
+    cp    0xFE
+    jr    z, 00103$
+    dec   hl
+    ld    a, h
+    or    l
+    jr    nz, 00102$
+    djnz  00102$
+    jr    00108$                ; no start token
+00103$:
+    ld    hl, 0x6000            ; PAGE_ADDRESS
+    ld    b, 0
+    inir                        ; 512 bytes
+    inir
+    in    a, (c)                ; CRC
+    in    a, (c)
+    dec   de
+    ld    a, d
+    or    e
+    jr    nz, 00101$
+    ld    a, (_g_uiSdFlags)
+    rst   8
+    defb  0x87                  ; DISK_STRMEND
+    jr    c, 00109$
+    ld    l, 0
+    pop   ix
+    ret
+00108$:
+    ld    a, (_g_uiSdFlags)
+    rst   8
+    defb  0x87                  ; DISK_STRMEND (release the card)
+00109$:
+    ld    l, 1
+    pop   ix
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
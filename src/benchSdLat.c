@@ -0,0 +1,269 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchSdLat.c                                                       |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "raster.h"
+#include "bench.h"
+#include "benchSd.h"
+#include "benchSdLat.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define DUMP_SDLATNAME "%-4s"
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Scratch file and buffer of the operations
+*/
+static char_t  g_acSdLatPath[0x10];
+static uint8_t g_hSdLatFile;
+static uint8_t g_auiSdLatBuffer[0x100];
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+/*!
+Operation under test
+@return true = "no error"
+*/
+typedef bool (*sdlatop_t)(void);
+
+/*!
+Named operation
+*/
+typedef struct _sdlatentry
+{
+  const char_t* acName;
+  sdlatop_t     pFn;
+} sdlatentry_t;
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Operations
+*/
+static bool benchSdLatSeek(void);
+static bool benchSdLatRead(void);
+static bool benchSdLatOpen(void);
+static bool benchSdLatStat(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Operations; the scratch file stays open during all of them, "OPEN" and
+"STAT" open and look up the same file a second time by its name
+*/
+static const sdlatentry_t g_tSdLatOps[] =
+{
+  {"SEEK", benchSdLatSeek},
+  {"READ", benchSdLatRead},
+  {"OPEN", benchSdLatOpen},
+  {"STAT", benchSdLatStat},
+  {0,      0             }
+};
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpSdLatencyBench()                                                       */
+/*----------------------------------------------------------------------------*/
+int dumpSdLatencyBench(char_t cDrive)
+{
+  static uint16_t auiTicks[sizeof(g_tSdLatOps) / sizeof(g_tSdLatOps[0])][BENCHSDLAT_SAMPLES];
+  int iReturn = EOK;
+
+  benchSdPath(g_acSdLatPath, cDrive);
+
+  /* Preallocated scratch file */
+  if (INV_FILE_HND == (g_hSdLatFile = esx_f_open(g_acSdLatPath, ESXDOS_MODE_W | ESXDOS_MODE_CT)))
+  {
+    return EACCES;
+  }
+
+  memset(g_auiSdLatBuffer, 0xE5, sizeof(g_auiSdLatBuffer));
+
+  for (uint16_t i = 0; (EOK == iReturn) && (i < (BENCHSD_TOTAL / sizeof(g_auiSdLatBuffer))); ++i)
+  {
+    if (sizeof(g_auiSdLatBuffer) != esx_f_write(g_hSdLatFile, g_auiSdLatBuffer, sizeof(g_auiSdLatBuffer)))
+    {
+      iReturn = EACCES;
+    }
+  }
+
+  esx_f_close(g_hSdLatFile);
+
+  if ((EOK == iReturn) && (INV_FILE_HND == (g_hSdLatFile = esx_f_open(g_acSdLatPath, ESXDOS_MODE_R | ESXDOS_MODE_OE))))
+  {
+    iReturn = EACCES;
+  }
+
+  if (EOK == iReturn)
+  {
+    srand(rasterLine());
+    benchWatchStart();
+
+    for (uint8_t i = 0; (EOK == iReturn) && (0 != g_tSdLatOps[i].acName); ++i)
+    {
+      for (uint8_t j = 0; j < BENCHSDLAT_SAMPLES; ++j)
+      {
+        const uint32_t uiStart = benchWatchRead();
+        uint32_t uiTicks;
+
+        if (!g_tSdLatOps[i].pFn())
+        {
+          iReturn = EACCES;
+          break;
+        }
+
+        uiTicks = (benchWatchRead() - uiStart) & 0x00FFFFFF;
+        auiTicks[i][j] = (uint16_t) (0xFFFF < uiTicks ? 0xFFFF : uiTicks);
+      }
+    }
+
+    benchWatchStop();
+    esx_f_close(g_hSdLatFile);
+  }
+
+  (void) esx_f_unlink(g_acSdLatPath);
+
+  if (EOK != iReturn)
+  {
+    return iReturn;
+  }
+
+  zheader("SD LATENCY (US, %s)", g_acSdLatPath);
+  zprintf("        P50   P95   P99    MAX\n");
+
+  for (uint8_t i = 0; 0 != g_tSdLatOps[i].acName; ++i)
+  {
+    uint16_t* pTicks = auiTicks[i];
+
+    benchSort(pTicks, BENCHSDLAT_SAMPLES);
+
+    zprintf(DUMP_SDLATNAME " %6lu %5lu %5lu %6lu\n", g_tSdLatOps[i].acName,
+            BENCH_WATCH_US(benchPercentile(pTicks, BENCHSDLAT_SAMPLES, 50)),
+            BENCH_WATCH_US(benchPercentile(pTicks, BENCHSDLAT_SAMPLES, 95)),
+            BENCH_WATCH_US(benchPercentile(pTicks, BENCHSDLAT_SAMPLES, 99)),
+            BENCH_WATCH_US(benchPercentile(pTicks, BENCHSDLAT_SAMPLES, 100)));
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdLatSeek()                                                           */
+/*----------------------------------------------------------------------------*/
+static bool benchSdLatSeek(void)
+{
+  const uint32_t uiOffset = ((uint32_t) rand()) % (BENCHSD_TOTAL - BENCHSDLAT_READ);
+
+  return (uiOffset == esx_f_seek(g_hSdLatFile, uiOffset, ESX_SEEK_SET));
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdLatRead()                                                           */
+/*----------------------------------------------------------------------------*/
+static bool benchSdLatRead(void)
+{
+  return benchSdLatSeek() &&
+         (BENCHSDLAT_READ == esx_f_read(g_hSdLatFile, g_auiSdLatBuffer, BENCHSDLAT_READ));
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdLatOpen()                                                           */
+/*----------------------------------------------------------------------------*/
+static bool benchSdLatOpen(void)
+{
+  uint8_t hFile;
+
+  if (INV_FILE_HND == (hFile = esx_f_open(g_acSdLatPath, ESXDOS_MODE_R | ESXDOS_MODE_OE)))
+  {
+    return false;
+  }
+
+  esx_f_close(hFile);
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchSdLatStat()                                                           */
+/*----------------------------------------------------------------------------*/
+static bool benchSdLatStat(void)
+{
+  struct esx_stat tStat;
+
+  return (0 == esx_f_stat(g_acSdLatPath, &tStat));
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,238 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: benchVideo.c                                                       |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <errno.h>
+#include <intrinsic.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "raster.h"
+#include "bench.h"
+#include "benchVideo.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+#define DUMP_VIDEONAME "%-11s"
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Wait for the start of the next frame and count the iterations of a loop with
+a known number of T-states (BENCHVIDEO_LOOPT) up to the start of the
+following frame.
+@return Iterations
+*/
+static uint16_t benchVideoFrame(void);
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpVideoBench()                                                           */
+/*----------------------------------------------------------------------------*/
+int dumpVideoBench(void)
+{
+  const benchtiming_t*  pTiming  = benchTiming();
+  const benchdisplay_t* pDisplay = benchDisplay();
+  const uint8_t uiRate = benchFrameRate();
+  uint32_t uiSum = 0;
+  uint16_t uiMin = 0xFFFF;
+  uint16_t uiMax = 0;
+  uint16_t uiLines = 0;
+  uint16_t uiIntMin = 0x1FF;
+  uint16_t uiIntMax = 0;
+  uint32_t uiFrameT;
+  uint32_t uiHz;
+
+  intrinsic_di();
+
+  /* Length of the frame: counted at 3.5 MHz, so there are no wait states */
+  benchSpeed(RTM_3MHZ);
+
+  for (uint8_t i = 0; i < BENCHVIDEO_FRAMES; ++i)
+  {
+    const uint16_t uiCount = benchVideoFrame();
+
+    uiSum += uiCount;
+    uiMin = (uiCount < uiMin ? uiCount : uiMin);
+    uiMax = (uiCount > uiMax ? uiCount : uiMax);
+  }
+
+  /* Lines and frame interrupt: polled at 28 MHz, so no line is missed */
+  benchSpeed(RTM_28MHZ);
+
+  for (uint8_t i = 0; i < BENCHVIDEO_FRAMES; ++i)
+  {
+    uint16_t uiLine;
+    uint16_t uiLast = rasterLine();
+    uint8_t  uiWraps = 0;
+
+    ZXN_WRITE_REG(0xC8, 0x01); /* clear the status of the ULA interrupt */
+
+    while (2 > uiWraps) /* the interrupt is disabled (NR 0x22), if not seen */
+    {
+      if ((uiLine = rasterLine()) > uiLines)
+      {
+        uiLines = uiLine;
+      }
+
+      if (ZXN_READ_REG(0xC8) & 0x01)
+      {
+        uiIntMin = (uiLine < uiIntMin ? uiLine : uiIntMin);
+        uiIntMax = (uiLine > uiIntMax ? uiLine : uiIntMax);
+        break;
+      }
+
+      if (uiLine < uiLast)
+      {
+        ++uiWraps;
+      }
+      uiLast = uiLine;
+    }
+  }
+
+  ZXN_WRITE_REG(0xC8, 0x01);
+  intrinsic_ei();
+
+  ++uiLines; /* lines are counted from 0 */
+
+  /* The CPU at 3.5 MHz runs with 1/8 of the master clock */
+  uiFrameT = (uiSum * BENCHVIDEO_LOOPT) / BENCHVIDEO_FRAMES;
+  uiHz     = (0 != uiFrameT ? (((uint32_t) pTiming->uiMaster) * 100000) / (uiFrameT * 8) : 0);
+
+  zheader("VIDEO TIMING");
+  zprintf(DUMP_VIDEONAME " = %s %u.%03u MHZ\n", "VIDEOTIMING", pTiming->acName, pTiming->uiMaster / 1000, pTiming->uiMaster % 1000);
+  zprintf(DUMP_VIDEONAME " = %s %u HZ\n",       "DISPTIMING",  pDisplay->acName, uiRate);
+  zprintf(DUMP_VIDEONAME " = %lu.%02lu HZ\n",   "REFRESH",     uiHz / 100, uiHz % 100);
+
+  if (0 != pDisplay->uiLineT)
+  {
+    const uint16_t uiExpLines = pDisplay->auiLines[60 == uiRate ? 1 : 0];
+
+    zprintf(DUMP_VIDEONAME " = %u (%u)\n",   "LINES",   uiLines, uiExpLines);
+    zprintf(DUMP_VIDEONAME " = %lu (%u)\n",  "T/LINE",  uiFrameT / uiLines, pDisplay->uiLineT);
+    zprintf(DUMP_VIDEONAME " = %lu (%lu)\n", "T/FRAME", uiFrameT, ((uint32_t) pDisplay->uiLineT) * uiExpLines);
+  }
+  else
+  {
+    zprintf(DUMP_VIDEONAME " = %u\n",  "LINES",   uiLines);
+    zprintf(DUMP_VIDEONAME " = %lu\n", "T/LINE",  uiFrameT / uiLines);
+    zprintf(DUMP_VIDEONAME " = %lu\n", "T/FRAME", uiFrameT);
+  }
+
+  zprintf(DUMP_VIDEONAME " = %lu T\n", "JITTER", ((uint32_t) (uiMax - uiMin)) * BENCHVIDEO_LOOPT);
+
+  if (uiIntMin <= uiIntMax)
+  {
+    zprintf(DUMP_VIDEONAME " = %u - %u\n", "INTLINE", uiIntMin, uiIntMax);
+  }
+  else
+  {
+    zprintf(DUMP_VIDEONAME " = %s\n", "INTLINE", "-");
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* benchVideoFrame()                                                          */
+/*----------------------------------------------------------------------------*/
+static uint16_t benchVideoFrame(void) __naked
+{
+  __asm
+    ld    bc, 0x243B
+    ld    a, 0x1E               ; ACTVIDLINEH
+    out   (c), a
+    inc   b                     ; 0x253B
+00101$:                         ; wait for the lines 256 ...
+    in    a, (c)
+    rra
+    jr    nc, 00101$
+00102$:                         ; wait for the start of the frame
+    in    a, (c)
+    rra
+    jr    c, 00102$
+    ld    hl, 0
+00103$:                         ; count the lines 0 - 255: 6 + 12 + 4 + 12 T
+    inc   hl
+    in    a, (c)
+    rra
+    jr    nc, 00103$
+00104$:                         ; count the lines 256 ...: 6 + 12 + 4 + 12 T
+    inc   hl
+    in    a, (c)
+    rra
+    jr    c, 00104$
+    ret
+  __endasm;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,355 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: bglog.c                                                            |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "sysDrv.h"
+#include "bglog.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Size of the frame stamp at the start of each record
+*/
+#define BGLOG_STAMP (3)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Default list of nregs: MMU slots, layers, palette and interrupt status
+*/
+static const uint8_t g_auiDefaultRegs[] =
+{
+  0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+  0x12, 0x15, 0x40, 0x43, 0x68, 0x69, 0x6B, 0xC8
+};
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Stop the IM1 routine and release the page of the background log
+@return EOK = "no error"
+*/
+static int bglogStop(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* bglogStart()                                                               */
+/*----------------------------------------------------------------------------*/
+int bglogStart(const char_t* acArg)
+{
+  int iReturn = EOK;
+  bgloghdr_t tHeader;
+  char_t* pEnd;
+  uint32_t uiValue;
+  uint8_t uiRate;
+  uint8_t uiPage;
+  uint16_t uiPageValue;
+
+  if (!sysDrvPresent())
+  {
+    fprintf(stderr, "driver not installed (.install sysinfo.drv)\n");
+    return ENOTSUP;
+  }
+
+  memset(&tHeader, 0, sizeof(tHeader));
+  memcpy(tHeader.acMagic, BGLOG_MAGIC, sizeof(tHeader.acMagic));
+  tHeader.uiVersion  = BGLOG_VERSION;
+  tHeader.uiRegCount = sizeof(g_auiDefaultRegs);
+  tHeader.uiVarAddr  = 0x5B5C; /* BANKM */
+  tHeader.uiVarSize  = 1;
+  memcpy(tHeader.auiRegs, g_auiDefaultRegs, sizeof(g_auiDefaultRegs));
+
+  uiValue = strtoul(acArg, &pEnd, 10);
+
+  if ((acArg == pEnd) || ((':' != *pEnd) && ('\0' != *pEnd)) || (0xFF < uiValue))
+  {
+    return EINVAL; /* not a number or out of range; a running log is kept */
+  }
+
+  if (0 == (uiRate = (uint8_t) uiValue))
+  {
+    return bglogStop();
+  }
+
+  /* List of nregs */
+  if (':' == *pEnd)
+  {
+    tHeader.uiRegCount = 0;
+    ++pEnd;
+
+    while ((EOK == iReturn) && (':' != *pEnd) && ('\0' != *pEnd))
+    {
+      const char_t* pStart = pEnd;
+
+      uiValue = strtoul(pStart, &pEnd, 16);
+
+      if ((pStart == pEnd) || ((',' != *pEnd) && (':' != *pEnd) && ('\0' != *pEnd)) || (0xFF < uiValue))
+      {
+        iReturn = EINVAL;
+      }
+      else if (BGLOG_REGS_MAX <= tHeader.uiRegCount)
+      {
+        iReturn = ERANGE;
+      }
+      else
+      {
+        tHeader.auiRegs[tHeader.uiRegCount++] = (uint8_t) uiValue;
+      }
+
+      if (',' == *pEnd)
+      {
+        ++pEnd;
+      }
+    }
+  }
+
+  /* Block of system variables */
+  if ((EOK == iReturn) && (':' == *pEnd))
+  {
+    const char_t* pStart = pEnd + 1;
+    uint32_t uiSize = 1;
+
+    uiValue = strtoul(pStart, &pEnd, 16);
+
+    if ((pStart != pEnd) && (',' == *pEnd))
+    {
+      pStart = pEnd + 1;
+      uiSize = strtoul(pStart, &pEnd, 10);
+    }
+
+    if ((pStart == pEnd) || ('\0' != *pEnd))
+    {
+      iReturn = EINVAL;
+    }
+    /* The driver maps the page into slot 6 or 7 while it copies the block */
+    else if ((BGLOG_VARS_MAX < uiSize) || ((uiValue + uiSize) > 0xC000))
+    {
+      iReturn = ERANGE;
+    }
+    else
+    {
+      tHeader.uiVarAddr = (uint16_t) uiValue;
+      tHeader.uiVarSize = (uint8_t) uiSize;
+    }
+  }
+
+  if (EOK == iReturn)
+  {
+    tHeader.uiRecSize = BGLOG_STAMP + tHeader.uiRegCount + tHeader.uiVarSize;
+    tHeader.uiFirst   = sizeof(bgloghdr_t);
+    tHeader.uiLimit   = sizeof(bgloghdr_t) +
+                        (((PAGE_SIZE - sizeof(bgloghdr_t)) / tHeader.uiRecSize) * tHeader.uiRecSize);
+
+    /* Reuse the page of a running log; the layout of the records may change */
+    (void) sysDrvSet(SYSDRV_FIELD_BGRATE, 0);
+
+    if ((EOK == sysDrvGet(SYSDRV_FIELD_BGPAGE, &uiPageValue)) && (0 != uiPageValue))
+    {
+      uiPage = (uint8_t) uiPageValue;
+    }
+    else if (PAGE_INVALID == (uiPage = pageAlloc()))
+    {
+      iReturn = ENOMEM;
+    }
+  }
+
+  if (EOK == iReturn)
+  {
+    memcpy(pageMap(uiPage), &tHeader, sizeof(tHeader));
+    pageUnmap();
+
+    (void) sysDrvSet(SYSDRV_FIELD_BGPAGE,  uiPage);
+    (void) sysDrvSet(SYSDRV_FIELD_BGNEXT,  tHeader.uiFirst);
+    (void) sysDrvSet(SYSDRV_FIELD_BGCOUNT, 0);
+    (void) sysDrvSet(SYSDRV_FIELD_BGRATE,  uiRate); /* starts the IM1 routine */
+
+    zprintf("logging %u nregs + %u bytes\n", tHeader.uiRegCount, tHeader.uiVarSize);
+    zprintf("every %u frames to page %u\n", uiRate, uiPage);
+    zprintf("%u records max.\n", (tHeader.uiLimit - tHeader.uiFirst) / tHeader.uiRecSize);
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* bglogStop()                                                                */
+/*----------------------------------------------------------------------------*/
+static int bglogStop(void)
+{
+  uint16_t uiPage;
+
+  (void) sysDrvSet(SYSDRV_FIELD_BGRATE, 0);
+
+  if ((EOK == sysDrvGet(SYSDRV_FIELD_BGPAGE, &uiPage)) && (0 != uiPage))
+  {
+    pageFree((uint8_t) uiPage);
+    (void) sysDrvSet(SYSDRV_FIELD_BGPAGE, 0);
+    zprintf("background log stopped\n");
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* bglogActive()                                                              */
+/*----------------------------------------------------------------------------*/
+bool bglogActive(void)
+{
+  uint16_t uiPage;
+
+  return (EOK == sysDrvGet(SYSDRV_FIELD_BGPAGE, &uiPage)) && (0 != uiPage);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* bglogFlush()                                                               */
+/*----------------------------------------------------------------------------*/
+int bglogFlush(void)
+{
+  int iReturn = EOK;
+  uint16_t uiPage;
+  uint16_t uiRate;
+  uint16_t uiNext;
+  uint16_t uiCount;
+  uint16_t uiSlots;
+  uint8_t* pPage;
+  bgloghdr_t* pHeader;
+  const uint8_t hFile = _dumpfile();
+
+  if (INV_FILE_HND == hFile)
+  {
+    return EINVAL; /* Error: no file */
+  }
+
+  if ((EOK != sysDrvGet(SYSDRV_FIELD_BGPAGE,  &uiPage))  ||
+      (EOK != sysDrvGet(SYSDRV_FIELD_BGRATE,  &uiRate))  ||
+      (EOK != sysDrvGet(SYSDRV_FIELD_BGNEXT,  &uiNext))  ||
+      (EOK != sysDrvGet(SYSDRV_FIELD_BGCOUNT, &uiCount)))
+  {
+    return EBADF; /* Error: no background log */
+  }
+
+  /*
+  The IM1 routine can't run while the page is mapped (interrupts are
+  disabled), so the records are consistent ...
+  */
+  pPage   = (uint8_t*) pageMap((uint8_t) uiPage);
+  pHeader = (bgloghdr_t*) pPage;
+  uiSlots = (pHeader->uiLimit - pHeader->uiFirst) / pHeader->uiRecSize;
+
+  if (uiCount >= uiSlots) /* ring buffer has wrapped: oldest record at "uiNext" */
+  {
+    pHeader->uiCount = uiSlots;
+
+    if ((sizeof(bgloghdr_t) != esx_f_write(hFile, pHeader, sizeof(bgloghdr_t))) ||
+        ((pHeader->uiLimit - uiNext) != esx_f_write(hFile, pPage + uiNext, pHeader->uiLimit - uiNext)) ||
+        ((uiNext - pHeader->uiFirst) != esx_f_write(hFile, pPage + pHeader->uiFirst, uiNext - pHeader->uiFirst)))
+    {
+      iReturn = EACCES;
+    }
+  }
+  else
+  {
+    pHeader->uiCount = uiCount;
+
+    if ((sizeof(bgloghdr_t) != esx_f_write(hFile, pHeader, sizeof(bgloghdr_t))) ||
+        ((uiNext - pHeader->uiFirst) != esx_f_write(hFile, pPage + pHeader->uiFirst, uiNext - pHeader->uiFirst)))
+    {
+      iReturn = EACCES;
+    }
+  }
+
+  uiCount = pHeader->uiCount;
+  uiNext  = pHeader->uiFirst;
+  pageUnmap();
+
+  if (EOK == iReturn)
+  {
+    (void) sysDrvSet(SYSDRV_FIELD_BGRATE,  0);
+    (void) sysDrvSet(SYSDRV_FIELD_BGNEXT,  uiNext);
+    (void) sysDrvSet(SYSDRV_FIELD_BGCOUNT, 0);
+    (void) sysDrvSet(SYSDRV_FIELD_BGRATE,  uiRate);
+
+    zprintf("%u records written\n", uiCount);
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
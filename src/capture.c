@@ -0,0 +1,208 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: capture.c                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "dumpRegs.h"
+#include "capture.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Read all four coordinates of every clip window without changing them
+@param pCapture Capture to complete
+*/
+static void captureClip(capture_t* pCapture);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* captureTake()                                                              */
+/*----------------------------------------------------------------------------*/
+void captureTake(capture_t* pCapture)
+{
+  uint8_t* pValue = &pCapture->auiRegs[0];
+  const regentry_t* pReg = &g_tRegisters[0];
+
+  memcpy(pCapture->auiFrames, (const void*) 0x5C78, sizeof(pCapture->auiFrames));
+
+  while ((0 != pReg->acName) && (pValue < &pCapture->auiRegs[CAPTURE_REGS_MAX]))
+  {
+    *pValue = (0x07 != pReg->uiNumber ? ZXN_READ_REG(pReg->uiNumber) : _cpuspeed());  /* UGLY HACK ! */
+    ++pValue;
+    ++pReg;
+  }
+
+  pCapture->uiRegCount = (uint8_t) (pValue - &pCapture->auiRegs[0]);
+  pCapture->uiDosDate  = 0;
+  pCapture->uiDosTime  = 0;
+
+  memcpy(pCapture->auiVars, (const void*) CAPTURE_VARS_ADDR, CAPTURE_VARS_SIZE);
+
+  captureClip(pCapture);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* captureClip()                                                              */
+/*----------------------------------------------------------------------------*/
+static void captureClip(capture_t* pCapture)
+{
+  uint8_t uiIndices = ZXN_READ_REG(0x1C); /* CLPWINCTRL */
+  uint8_t uiIndex;
+  uint8_t uiValue;
+
+  for (uint8_t i = 0; i < CAPTURE_CLIP_MAX; ++i)
+  {
+    uiIndex = (uiIndices >> (i << 1)) & 0x03;
+
+    /*
+    Reading does not advance the index. Writing back the same value does, and
+    after four writes the index is back at its start ...
+    */
+    for (uint8_t j = 0; j < 4; ++j)
+    {
+      uiValue = ZXN_READ_REG(0x18 + i);
+      pCapture->auiClip[i][(uiIndex + j) & 0x03] = uiValue;
+      ZXN_WRITE_REG(0x18 + i, uiValue);
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* captureStamp()                                                             */
+/*----------------------------------------------------------------------------*/
+void captureStamp(capture_t* pCapture)
+{
+  struct dos_tm tRaw;
+
+  if (0 == esx_m_getdate(&tRaw))
+  {
+    pCapture->uiDosDate = tRaw.date;
+    pCapture->uiDosTime = tRaw.time;
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* captureFrames()                                                            */
+/*----------------------------------------------------------------------------*/
+uint32_t captureFrames(const capture_t* pCapture)
+{
+  return ((uint32_t) pCapture->auiFrames[0])         |
+         ((uint32_t) pCapture->auiFrames[1] <<  8)   |
+         ((uint32_t) pCapture->auiFrames[2] << 16);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* captureChanges()                                                           */
+/*----------------------------------------------------------------------------*/
+uint16_t captureChanges(const capture_t* pOld, const capture_t* pNew)
+{
+  uint16_t uiChanges = 0;
+
+  for (uint8_t i = 0; i < pNew->uiRegCount; ++i)
+  {
+    if (pOld->auiRegs[i] != pNew->auiRegs[i])
+    {
+      ++uiChanges;
+    }
+  }
+
+  for (uint16_t i = 0; i < CAPTURE_VARS_SIZE; ++i)
+  {
+    if (pOld->auiVars[i] != pNew->auiVars[i])
+    {
+      ++uiChanges;
+    }
+  }
+
+  for (uint8_t i = 0; i < CAPTURE_CLIP_MAX; ++i)
+  {
+    if (0 != memcmp(pOld->auiClip[i], pNew->auiClip[i], sizeof(pNew->auiClip[i])))
+    {
+      ++uiChanges;
+    }
+  }
+
+  return uiChanges;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
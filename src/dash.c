@@ -0,0 +1,266 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dash.c                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "watch.h"
+#include "dash.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Control code of the terminal to position the cursor (AT row, col)
+*/
+#define DASH_AT  (0x16)
+
+/*!
+Control code of the terminal to clear the screen
+*/
+#define DASH_CLS (0x0C)
+
+/*!
+The number of free pages is read from NextOS (slow) only every n updates
+*/
+#define DASH_FREE_RATE (50)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Layout of the dashboard (fits on a screen with 32 columns)
+*/
+static const dashcell_t g_tCells[] =
+{
+  { 2,  0, DASH_SRC_NREG | 0x07, "CPU   " },
+  { 2, 13, DASH_SRC_FRAMES,      "FRAMES " },
+  { 4,  0, DASH_SRC_NREG | 0x50, "MMU 0 " },
+  { 4,  9, DASH_SRC_NREG | 0x51, "1 "     },
+  { 4, 14, DASH_SRC_NREG | 0x52, "2 "     },
+  { 4, 19, DASH_SRC_NREG | 0x53, "3 "     },
+  { 5,  4, DASH_SRC_NREG | 0x54, "4 "     },
+  { 5,  9, DASH_SRC_NREG | 0x55, "5 "     },
+  { 5, 14, DASH_SRC_NREG | 0x56, "6 "     },
+  { 5, 19, DASH_SRC_NREG | 0x57, "7 "     },
+  { 7,  0, DASH_SRC_NREG | 0x15, "LAYER "  },
+  { 7, 13, DASH_SRC_NREG | 0x68, "ULA    " },
+  { 8,  0, DASH_SRC_NREG | 0x69, "DISP  "  },
+  { 8, 13, DASH_SRC_NREG | 0x6B, "TILES  " },
+  {10,  0, DASH_SRC_NREG | 0xC8, "IRQ   "  },
+  {10,  9, DASH_SRC_NREG | 0xC9, ""        },
+  {10, 12, DASH_SRC_NREG | 0xCA, ""        },
+  {12,  0, DASH_SRC_FREE,        "FREE  "  },
+  /* ---------------------- */
+  { 0,  0, 0,                    NULL      }
+};
+
+/*!
+Last value shown in each cell
+*/
+static uint32_t g_auiShown[sizeof(g_tCells) / sizeof(g_tCells[0])];
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Read the current raw value of a cell
+@param pCell Cell to read
+@param uiFree Number of free pages (last value read from NextOS)
+@return Raw value
+*/
+static uint32_t dashRead(const dashcell_t* pCell, uint8_t uiFree);
+
+/*!
+Draw the value of a cell at its position
+@param pCell Cell to draw
+@param uiValue Raw value to draw
+*/
+static void dashDraw(const dashcell_t* pCell, uint32_t uiValue);
+
+/*!
+Position the cursor of the terminal
+@param uiRow Row
+@param uiCol Column
+*/
+static void dashAt(uint8_t uiRow, uint8_t uiCol);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dashShow()                                                                 */
+/*----------------------------------------------------------------------------*/
+int dashShow(uint8_t uiFrames)
+{
+  int iReturn = EOK;
+  uint8_t uiFree = esx_ide_bank_avail(ESX_BANKTYPE_RAM);
+  uint8_t uiRate = DASH_FREE_RATE;
+  uint32_t uiValue;
+
+  /* Static part: title, labels and the first values */
+  putchar(DASH_CLS);
+  dashAt(0, 0);
+  printf("SYSINFO DASHBOARD (BREAK)");
+
+  for (uint8_t i = 0; 0 != g_tCells[i].acLabel; ++i)
+  {
+    dashAt(g_tCells[i].uiRow, g_tCells[i].uiCol);
+    printf("%s", g_tCells[i].acLabel);
+
+    g_auiShown[i] = dashRead(&g_tCells[i], uiFree);
+    dashDraw(&g_tCells[i], g_auiShown[i]);
+  }
+
+  /* Dynamic part: redraw only the cells that have changed */
+  while (!watchBreak())
+  {
+    watchWait(uiFrames);
+
+    if (0 == --uiRate)
+    {
+      uiFree = esx_ide_bank_avail(ESX_BANKTYPE_RAM);
+      uiRate = DASH_FREE_RATE;
+    }
+
+    for (uint8_t i = 0; 0 != g_tCells[i].acLabel; ++i)
+    {
+      if ((uiValue = dashRead(&g_tCells[i], uiFree)) != g_auiShown[i])
+      {
+        g_auiShown[i] = uiValue;
+        dashDraw(&g_tCells[i], uiValue);
+      }
+    }
+  }
+
+  dashAt(14, 0);
+  printf("\n");
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* dashRead()                                                                 */
+/*----------------------------------------------------------------------------*/
+static uint32_t dashRead(const dashcell_t* pCell, uint8_t uiFree)
+{
+  switch (pCell->uiSource & 0xFF00)
+  {
+    case DASH_SRC_FRAMES:
+      return ((uint32_t) (*((const uint8_t*) 0x5C78)))         |
+             ((uint32_t) (*((const uint8_t*) 0x5C79)) <<  8)   |
+             ((uint32_t) (*((const uint8_t*) 0x5C7A)) << 16);
+
+    case DASH_SRC_FREE:
+      return uiFree;
+  }
+
+  if (0x07 == pCell->uiSource)
+  {
+    return _cpuspeed(); /* UGLY HACK ! */
+  }
+
+  return ZXN_READ_REG(pCell->uiSource & 0xFF);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* dashDraw()                                                                 */
+/*----------------------------------------------------------------------------*/
+static void dashDraw(const dashcell_t* pCell, uint32_t uiValue)
+{
+  dashAt(pCell->uiRow, pCell->uiCol + strlen(pCell->acLabel));
+
+  switch (pCell->uiSource & 0xFF00)
+  {
+    case DASH_SRC_FRAMES:
+      printf("%8lu", uiValue);
+      break;
+
+    case DASH_SRC_FREE:
+      printf("%3u PAGES", (uint8_t) uiValue);
+      break;
+
+    default:
+      printf("%02X", (uint8_t) uiValue);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* dashAt()                                                                   */
+/*----------------------------------------------------------------------------*/
+static void dashAt(uint8_t uiRow, uint8_t uiCol)
+{
+  putchar(DASH_AT);
+  putchar(uiRow);
+  putchar(uiCol);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,431 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: diff.c                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "dumpRegs.h"
+#include "dumpVars.h"
+#include "capture.h"
+#include "history.h"
+#include "diff.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Size of the buffers to collect the decoded output of a single value
+*/
+#define DIFF_SINK_MAX (0x300)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+All data of the comparison (too big for the stack)
+*/
+static struct _diff
+{
+  /*!
+  Previous capture (loaded from file)
+  */
+  capture_t tOld;
+
+  /*!
+  Current capture
+  */
+  capture_t tNew;
+
+  /*!
+  Flags: nreg is contained in the previous capture
+  */
+  bool abRegValid[CAPTURE_REGS_MAX];
+
+  /*!
+  Flags: byte of system variables is contained in the previous capture
+  */
+  bool abVarValid[CAPTURE_VARS_SIZE];
+
+  /*!
+  Flag: clip windows are contained in the previous capture (binary only)
+  */
+  bool bClipValid;
+
+  /*!
+  Decoded output of the old value
+  */
+  char_t acOld[DIFF_SINK_MAX];
+
+  /*!
+  Decoded output of the new value
+  */
+  char_t acNew[DIFF_SINK_MAX];
+
+  /*!
+  Line of a text capture
+  */
+  char_t acLine[LINE_LEN_MAX];
+} g_tDiff;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Load a text dump of the application
+@param acPathName Pathname of the file
+@return EOK = "no error"
+*/
+static int diffLoadText(const char_t* acPathName);
+
+/*!
+Interpret a single line of a text dump. Lines of nregs ("XX-NAME = 0xXX")
+and system variables ("XXXX-NAME = ...") are used, all others are ignored.
+@param acLine Line without line end
+*/
+static void diffParseLine(char_t* acLine);
+
+/*!
+Output all lines of the new decoded output that differ from the old one. The
+old value is appended to each changed line.
+@return Number of changed lines
+*/
+static uint8_t diffLines(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* diffCapture()                                                              */
+/*----------------------------------------------------------------------------*/
+int diffCapture(const char_t* acPathName)
+{
+  int iReturn = EOK;
+  uint16_t uiChanges = 0;
+
+  memset(g_tDiff.abRegValid, 0, sizeof(g_tDiff.abRegValid));
+  memset(g_tDiff.abVarValid, 0, sizeof(g_tDiff.abVarValid));
+  g_tDiff.bClipValid = false;
+
+  captureTake(&g_tDiff.tNew);
+
+  if (EOK == (iReturn = histLoad(acPathName, &g_tDiff.tOld)))
+  {
+    memset(g_tDiff.abRegValid, true, sizeof(g_tDiff.abRegValid));
+    memset(g_tDiff.abVarValid, true, sizeof(g_tDiff.abVarValid));
+    g_tDiff.bClipValid = true;
+  }
+  else if (ENOTSUP == iReturn)
+  {
+    iReturn = diffLoadText(acPathName);
+  }
+
+  if (EOK == iReturn)
+  {
+    zheader("CHANGED REGISTERS");
+
+    for (uint8_t i = 0; i < g_tDiff.tNew.uiRegCount; ++i)
+    {
+      const regentry_t* pReg = &g_tRegisters[i];
+      uint8_t uiOld = g_tDiff.tOld.auiRegs[i];
+      uint8_t uiNew = g_tDiff.tNew.auiRegs[i];
+
+      if (g_tDiff.abRegValid[i] && (uiOld != uiNew))
+      {
+        zprintf(DUMP_REGNUM "-" DUMP_REGNAME " = 0x%02X <- 0x%02X\n", pReg->uiNumber, pReg->acName, uiNew, uiOld);
+
+        zsink(g_tDiff.acOld, sizeof(g_tDiff.acOld));
+        dumpRegisterValue(pReg->uiNumber, uiOld);
+        zsink(g_tDiff.acNew, sizeof(g_tDiff.acNew));
+        dumpRegisterValue(pReg->uiNumber, uiNew);
+        zsink(0, 0);
+
+        diffLines();
+        ++uiChanges;
+      }
+    }
+
+    for (uint8_t i = 0; g_tDiff.bClipValid && (i < CAPTURE_CLIP_MAX); ++i)
+    {
+      const uint8_t* pOld = g_tDiff.tOld.auiClip[i];
+      const uint8_t* pNew = g_tDiff.tNew.auiClip[i];
+
+      if (0 != memcmp(pOld, pNew, sizeof(g_tDiff.tNew.auiClip[i])))
+      {
+        zprintf(DUMP_REGNUM "-CLIP = %02X %02X %02X %02X <- %02X %02X %02X %02X\n",
+                0x18 + i, pNew[0], pNew[1], pNew[2], pNew[3], pOld[0], pOld[1], pOld[2], pOld[3]);
+        ++uiChanges;
+      }
+    }
+
+    zheader("CHANGED SYSTEM VARIABLES");
+
+    const varentry_t* pVar = &g_tVariables[0];
+    while (0 != pVar->acName)
+    {
+      uint16_t uiOffset = pVar->uiAddress - CAPTURE_VARS_ADDR;
+
+      if ((0 != pVar->uiSize) &&
+          g_tDiff.abVarValid[uiOffset] &&
+          (0 != memcmp(&g_tDiff.tOld.auiVars[uiOffset], &g_tDiff.tNew.auiVars[uiOffset], pVar->uiSize)))
+      {
+        zsink(g_tDiff.acOld, sizeof(g_tDiff.acOld));
+        dumpVariable(pVar, &g_tDiff.tOld.auiVars[uiOffset]);
+        zsink(g_tDiff.acNew, sizeof(g_tDiff.acNew));
+        dumpVariable(pVar, &g_tDiff.tNew.auiVars[uiOffset]);
+        zsink(0, 0);
+
+        diffLines();
+        ++uiChanges;
+      }
+
+      ++pVar;
+    }
+
+    zheader("%u CHANGES SINCE %s", uiChanges, acPathName);
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* diffLoadText()                                                             */
+/*----------------------------------------------------------------------------*/
+static int diffLoadText(const char_t* acPathName)
+{
+  uint8_t  hFile;
+  uint8_t  acChunk[0x80];
+  uint16_t uiRead;
+  uint16_t uiLen = 0;
+
+  if (INV_FILE_HND == (hFile = esx_f_open(acPathName, ESXDOS_MODE_R | ESXDOS_MODE_OE)))
+  {
+    return EBADF;
+  }
+
+  while (0 < (uiRead = esx_f_read(hFile, acChunk, sizeof(acChunk))))
+  {
+    for (uint16_t i = 0; i < uiRead; ++i)
+    {
+      register char_t c = (char_t) acChunk[i];
+
+      if ('\n' == c)
+      {
+        g_tDiff.acLine[uiLen] = '\0';
+        diffParseLine(g_tDiff.acLine);
+        uiLen = 0;
+      }
+      else if (('\r' != c) && (uiLen < (sizeof(g_tDiff.acLine) - 1)))
+      {
+        g_tDiff.acLine[uiLen++] = c;
+      }
+    }
+
+    if (uiRead < sizeof(acChunk))
+    {
+      break;
+    }
+  }
+
+  esx_f_close(hFile);
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* diffParseLine()                                                            */
+/*----------------------------------------------------------------------------*/
+static void diffParseLine(char_t* acLine)
+{
+  char_t* acValue;
+
+  if (0 == (acValue = strstr(acLine, " = ")))
+  {
+    return;
+  }
+  acValue += 3;
+
+  if (isxdigit(acLine[0]) && isxdigit(acLine[1]) && ('-' == acLine[2])) /* nreg */
+  {
+    uint8_t uiNumber = (uint8_t) strtoul(acLine, 0, 16);
+
+    for (uint8_t i = 0; i < g_tDiff.tNew.uiRegCount; ++i)
+    {
+      if (g_tRegisters[i].uiNumber == uiNumber)
+      {
+        g_tDiff.tOld.auiRegs[i] = (uint8_t) strtoul(acValue, 0, 16);
+        g_tDiff.abRegValid[i] = true;
+        break;
+      }
+    }
+  }
+  else if (isxdigit(acLine[0]) && isxdigit(acLine[3]) && ('-' == acLine[4])) /* sysvar */
+  {
+    uint16_t uiAddress = (uint16_t) strtoul(acLine, 0, 16);
+    const varentry_t* pVar = &g_tVariables[0];
+
+    while ((0 != pVar->acName) && (pVar->uiAddress != uiAddress))
+    {
+      ++pVar;
+    }
+
+    if ((0 != pVar->acName) && (0 != pVar->uiSize))
+    {
+      uint16_t uiOffset = uiAddress - CAPTURE_VARS_ADDR;
+      uint8_t* pDst = &g_tDiff.tOld.auiVars[uiOffset];
+
+      if (('<' == acValue[0]) || ('0' == acValue[0] && 'x' == acValue[1])) /* number */
+      {
+        uint32_t uiValue = 0;
+
+        if ('0' == acValue[0])
+        {
+          uiValue = strtoul(acValue, 0, 16);      /* "0x1234" */
+        }
+        else if ('n' != acValue[1])
+        {
+          uiValue = strtoul(acValue + 1, 0, 16);  /* "<1234>", "<null>" */
+        }
+
+        for (uint8_t i = 0; i < pVar->uiSize; ++i)
+        {
+          pDst[i] = (uint8_t) uiValue;
+          uiValue >>= 8;
+        }
+      }
+      else /* hex dump */
+      {
+        uint8_t i = 0;
+
+        while ((i < pVar->uiSize) && ('\0' != *acValue))
+        {
+          if (isxdigit(acValue[0]) && isxdigit(acValue[1]))
+          {
+            char_t acByte[3] = {acValue[0], acValue[1], '\0'};
+            pDst[i++] = (uint8_t) strtoul(acByte, 0, 16);
+            acValue += 2;
+          }
+          else
+          {
+            ++acValue;
+          }
+        }
+      }
+
+      memset(&g_tDiff.abVarValid[uiOffset], true, pVar->uiSize);
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* diffLines()                                                                */
+/*----------------------------------------------------------------------------*/
+static uint8_t diffLines(void)
+{
+  uint8_t uiChanged = 0;
+  char_t* acOld = g_tDiff.acOld;
+  char_t* acNew = g_tDiff.acNew;
+  char_t* acOldEnd;
+  char_t* acNewEnd;
+
+  while ('\0' != *acNew)
+  {
+    if (0 != (acNewEnd = strchr(acNew, '\n')))
+    {
+      *acNewEnd = '\0';
+    }
+
+    if (0 != (acOldEnd = ('\0' != *acOld ? strchr(acOld, '\n') : 0)))
+    {
+      *acOldEnd = '\0';
+    }
+
+    if (0 != strcmp(acOld, acNew))
+    {
+      char_t* acOldValue = strstr(acOld, " = ");
+      zprintf("%s <- %s\n", acNew, (0 != acOldValue ? acOldValue + 3 : "-"));
+      ++uiChanged;
+    }
+
+    if (0 == acNewEnd)
+    {
+      break;
+    }
+
+    acNew = acNewEnd + 1;
+    acOld = (0 != acOldEnd ? acOldEnd + 1 : acOld + strlen(acOld));
+  }
+
+  return uiChanged;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -49,6 +49,7 @@
 
 #include "sysinfo.h"
 #include "dumpDos.h"
+#include "sysDrv.h"
 
 /*============================================================================*/
 /*                               Defines                                      */
@@ -233,63 +234,26 @@ int dumpOperatingSystem(void)
   // Available drives
   if (EOK == iReturn)
   {
-    uint8_t uiResult;
-    uint8_t uiDrive;
-    uint8_t uiIdx = 0;
-    char_t  acDrives[20];
+    uint8_t  uiIdx = 0;
+    uint16_t uiDrives;
+    char_t   acDrives[20];
 
     acDrives[0] = '\0';
 
-    if (ESX_DOSVERSION_NEXTOS_48K == uiOsVersion) /* NEXTZXOS == 48K Mode */
+    /* The resident driver knows the drives already; scanning is expensive */
+    if (EOK != sysDrvGet(SYSDRV_FIELD_DRIVES, &uiDrives))
     {
-      uint8_t uiEsxDrv;
-
-      uiDrive = esx_m_getdrv();
-      for (char_t cDrive = 'A'; cDrive <= 'P'; ++cDrive)
-      {
-        uiEsxDrv = ((cDrive - 'A') << 3) | 0x01;
-
-        /*
-        'C'  => 16
-        'M'  => 96
-        Rest => 255
-        */
-        if (0xFF != (uiResult = esx_m_setdrv(uiEsxDrv)))
-        {
-          acDrives[uiIdx] = cDrive;
-          ++uiIdx;
-          acDrives[uiIdx] = '\0';
-        }
-       #if defined(__DEBUG__)
-        else
-        {
-          fprintf(stderr, "dumpOs() - esx_m_setdrv(%c|0x%X) = %u\n", cDrive, uiEsxDrv, uiResult);
-        }
-       #endif
-      }
-      esx_m_setdrv(uiDrive);
+      uiDrives = getAvailableDrives();
     }
-    else /* NEXTZXOS != 48K Mode */
+
+    for (char_t cDrive = 'A'; cDrive <= 'P'; ++cDrive)
     {
-      uiDrive = esx_dos_get_drive();
-      for (char_t cDrive = 'A'; cDrive <= 'P'; ++cDrive)
+      if (uiDrives & (1 << (cDrive - 'A')))
       {
-        if (0 == (uiResult = esx_dos_set_drive(cDrive)))
-        {
-          acDrives[uiIdx] = cDrive;
-          ++uiIdx;
-          acDrives[uiIdx] = '\0';
-        }
-       #if defined(__DEBUG__)
-        else
-        {
-          fprintf(stderr, "dumpOs() - esx_dos_set_drive(%c) = %u\n", cDrive, uiResult);
-        }
-       #endif
+        acDrives[uiIdx] = cDrive;
+        ++uiIdx;
+        acDrives[uiIdx] = '\0';
       }
-      esx_dos_set_drive(uiDrive);
-      SYSVAR_LODDRV = uiDrive;
-      SYSVAR_SAVDRV = uiDrive;
     }
 
     zprintf(DUMP_NOSNAME " = %s\n", "AVAIL.DRIVES", acDrives);
@@ -384,6 +348,67 @@ int dumpOperatingSystem(void)
 #endif
 
 
+/*----------------------------------------------------------------------------*/
+/* getAvailableDrives()                                                       */
+/*----------------------------------------------------------------------------*/
+uint16_t getAvailableDrives(void)
+{
+  uint16_t uiDrives = 0;
+  uint8_t  uiResult;
+  uint8_t  uiDrive;
+
+  if (ESX_DOSVERSION_NEXTOS_48K == esx_m_dosversion()) /* NEXTZXOS == 48K Mode */
+  {
+    uint8_t uiEsxDrv;
+
+    uiDrive = esx_m_getdrv();
+    for (char_t cDrive = 'A'; cDrive <= 'P'; ++cDrive)
+    {
+      uiEsxDrv = ((cDrive - 'A') << 3) | 0x01;
+
+      /*
+      'C'  => 16
+      'M'  => 96
+      Rest => 255
+      */
+      if (0xFF != (uiResult = esx_m_setdrv(uiEsxDrv)))
+      {
+        uiDrives |= (1 << (cDrive - 'A'));
+      }
+     #if defined(__DEBUG__)
+      else
+      {
+        fprintf(stderr, "getDrives() - esx_m_setdrv(%c|0x%X) = %u\n", cDrive, uiEsxDrv, uiResult);
+      }
+     #endif
+    }
+    esx_m_setdrv(uiDrive);
+  }
+  else /* NEXTZXOS != 48K Mode */
+  {
+    uiDrive = esx_dos_get_drive();
+    for (char_t cDrive = 'A'; cDrive <= 'P'; ++cDrive)
+    {
+      if (0 == (uiResult = esx_dos_set_drive(cDrive)))
+      {
+        uiDrives |= (1 << (cDrive - 'A'));
+      }
+     #if defined(__DEBUG__)
+      else
+      {
+        fprintf(stderr, "getDrives() - esx_dos_set_drive(%c) = %u\n", cDrive, uiResult);
+      }
+     #endif
+    }
+    esx_dos_set_drive(uiDrive);
+    SYSVAR_LODDRV = uiDrive;
+    SYSVAR_SAVDRV = uiDrive;
+  }
+
+  return uiDrives;
+}
+
+
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
 /*----------------------------------------------------------------------------*/
@@ -40,8 +40,10 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <errno.h>
 #include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
 #include <intrinsic.h>
 #include "sysinfo.h"
 #include "dumpRegs.h"
@@ -216,6 +218,11 @@ const regentry_t g_tRegisters[] =
   {0x00, 0x00, NULL         }
 };
 
+/*!
+Buffer to render the complete matrix of "dumpRegisterMatrix" (header + 16 rows)
+*/
+static char_t g_acMatrix[17 * (DUMP_MATRIX_WIDE + 1) + 1];
+
 /*============================================================================*/
 /*                               Strukturen                                   */
 /*============================================================================*/
@@ -293,38 +300,132 @@ int dumpRegisters(void)
 
     zprintf(DUMP_REGNUM "-" DUMP_REGNAME " = 0x%02X\n", pReg->uiNumber, pReg->acName, uiValue);
 
-    /*
-    REMARK: Strange if-cascade to avoid a very huge switch-case (256 cases)
-            because SDCC seems to have a problem with the optimization of this
-            (very-very-very long time to compile) ...         S.Zell, 10/25/2025
-    */
+    dumpRegisterValue(pReg->uiNumber, uiValue);
 
-    if (ZXN_BETWEEN(pReg->uiNumber, 0x00, 0x3F)) /* ============================= */
-    {
-      dumpRegister_00_3F(pReg->uiNumber, uiValue);
-    }
-    else if (ZXN_BETWEEN(pReg->uiNumber, 0x40, 0x7F)) /* ======================== */
-    {
-      dumpRegister_40_7F(pReg->uiNumber, uiValue);
-    }
-    else if (ZXN_BETWEEN(pReg->uiNumber, 0x80, 0xBF)) /* ======================== */
+    ++pReg;
+  }
+
+  return iReturn;
+
+}
+#if defined(__SDCC)
+#pragma restore
+#endif
+
+
+/*----------------------------------------------------------------------------*/
+/* dumpRegisterMatrix()                                                       */
+/*----------------------------------------------------------------------------*/
+int dumpRegisterMatrix(void)
+{
+  int iReturn = EOK;
+
+  static const char_t acHex[] = "0123456789ABCDEF";
+
+  const bool bWide = (_screencols() >= DUMP_MATRIX_WIDE);
+  const uint8_t uiCell = (bWide ? 3 : 2);
+  const uint8_t uiLabel = (bWide ? 3 : 0);
+  const uint8_t uiLine = uiLabel + (uiCell << 4) + 1;
+
+  /* A row as wide as the screen wraps by itself: no line end on screen */
+  const bool bFit = ((uiLine - 1) == _screencols());
+
+  char_t* pLine = &g_acMatrix[0];
+  uint8_t uiValue;
+
+  zheader("NEXT REGISTERS");
+
+  /* Empty matrix: column header and blank rows */
+  for (uint8_t uiRow = 0; uiRow < 17; ++uiRow)
+  {
+    memset(pLine, ' ', uiLine - 1);
+    pLine[uiLine - 1] = (bFit ? '\0' : '\n');
+
+    if (0 == uiRow)
     {
-      dumpRegister_80_BF(pReg->uiNumber, uiValue);
+      for (uint8_t uiCol = 0; uiCol < 16; ++uiCol)
+      {
+        pLine[uiLabel + (uiCol * uiCell) + uiCell - 1] = acHex[uiCol];
+      }
     }
-    else if (ZXN_BETWEEN(pReg->uiNumber, 0xC0, 0xFF)) /* ======================== */
+    else if (bWide)
     {
-      dumpRegister_C0_FF(pReg->uiNumber, uiValue);
+      pLine[0] = acHex[uiRow - 1];
+      pLine[1] = '0';
+      pLine[2] = ':';
     }
 
+    pLine += uiLine;
+  }
+
+  *pLine = '\0';
+
+  /* Fill in the value of all listed nregs */
+  const regentry_t* pReg = &g_tRegisters[0];
+  while (0 != pReg->acName)
+  {
+    uiValue = (0x07 != pReg->uiNumber ? ZXN_READ_REG(pReg->uiNumber) : _cpuspeed());  /* UGLY HACK ! */
+
+    pLine = &g_acMatrix[(((pReg->uiNumber >> 4) + 1) * uiLine) + uiLabel + ((pReg->uiNumber & 0x0F) * uiCell) + uiCell - 2];
+    pLine[0] = acHex[uiValue >> 4];
+    pLine[1] = acHex[uiValue & 0x0F];
+
     ++pReg;
   }
 
+  if (bFit)
+  {
+    for (uint8_t uiRow = 0; uiRow < 17; ++uiRow)
+    {
+      zwrite(&g_acMatrix[uiRow * uiLine], uiLine - 1);
+
+      if (INV_FILE_HND != _dumpfile())
+      {
+        esx_f_write(_dumpfile(), "\n", 1);
+      }
+    }
+  }
+  else
+  {
+    zwrite(g_acMatrix, (uint16_t) (17 * uiLine));
+  }
+
   return iReturn;
+}
 
+
+/*----------------------------------------------------------------------------*/
+/* dumpRegisterValue()                                                        */
+/*----------------------------------------------------------------------------*/
+int dumpRegisterValue(uint8_t uiRegNum, uint8_t uiValue)
+{
+  int iReturn = EOK;
+
+  /*
+  REMARK: Strange if-cascade to avoid a very huge switch-case (256 cases)
+          because SDCC seems to have a problem with the optimization of this
+          (very-very-very long time to compile) ...         S.Zell, 10/25/2025
+  */
+
+  if (ZXN_BETWEEN(uiRegNum, 0x00, 0x3F)) /* =================================== */
+  {
+    iReturn = dumpRegister_00_3F(uiRegNum, uiValue);
+  }
+  else if (ZXN_BETWEEN(uiRegNum, 0x40, 0x7F)) /* ============================== */
+  {
+    iReturn = dumpRegister_40_7F(uiRegNum, uiValue);
+  }
+  else if (ZXN_BETWEEN(uiRegNum, 0x80, 0xBF)) /* ============================== */
+  {
+    iReturn = dumpRegister_80_BF(uiRegNum, uiValue);
+  }
+  else if (ZXN_BETWEEN(uiRegNum, 0xC0, 0xFF)) /* ============================== */
+  {
+    iReturn = dumpRegister_C0_FF(uiRegNum, uiValue);
+  }
+
+  return iReturn;
 }
-#if defined(__SDCC)
-#pragma restore
-#endif
 
 
 /*----------------------------------------------------------------------------*/
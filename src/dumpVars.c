@@ -74,7 +74,7 @@ List of all system variables that will be dumped
 BIT7 = Variable is a pointer
 @endcode
 */
-static const varentry_t g_tVariables[] = 
+const varentry_t g_tVariables[] = 
 {
   {0x5B00, 0x10, 0x00, "SWAP"     },
   {0x5B10, 0x11, 0x00, "STOO"     },
@@ -228,151 +228,164 @@ int dumpVariables(void)
 {
   int iReturn = EOK;
 
-  union 
-  {
-    uint8_t  uiRaw8[4];
-    uint16_t uiRaw16[2];
-    uint32_t uiRaw32;
-  } value;
-  
   zheader("SYSTEM VARIABLES");
 
   const varentry_t* pVar = &g_tVariables[0];
   while (0 != pVar->acName)
   {
-    value.uiRaw32 = 0;  
+    dumpVariable(pVar, (const uint8_t*) pVar->uiAddress);
 
-    switch (pVar->uiSize)
-    {
-      case 0:
-        snprintf(g_acValue, sizeof(g_acValue), "%s", "null");
-        break;
-
-      case 1:
-        value.uiRaw8[0] = ((uint8_t*) pVar->uiAddress)[0];
-        snprintf(g_acValue, sizeof(g_acValue), "0x%02X", value.uiRaw8[0]);
-        break;
+    ++pVar;
+  }
 
-      case 2:
-        value.uiRaw8[0] = ((uint8_t*) pVar->uiAddress)[0]; 
-        value.uiRaw8[1] = ((uint8_t*) pVar->uiAddress)[1]; 
+  return iReturn;
+}
 
-        if (0 != (pVar->uiFlags & (1 << 7))) /* ptr ? */
-        {
-          if (0 != value.uiRaw16[0]) /* NULL ? */
-          {
-            snprintf(g_acValue, sizeof(g_acValue), "<%04X>", value.uiRaw16[0]);
-          }
-          else
-          {
-            snprintf(g_acValue, sizeof(g_acValue), "<%s>", "null");
-          }
-        }
-        else
-        {
-          snprintf(g_acValue, sizeof(g_acValue), "0x%04X", value.uiRaw16[0]);
-        }
-        break;
 
-      case 3:
-        value.uiRaw8[0] = ((uint8_t*) pVar->uiAddress)[0]; 
-        value.uiRaw8[1] = ((uint8_t*) pVar->uiAddress)[1]; 
-        value.uiRaw8[2] = ((uint8_t*) pVar->uiAddress)[2]; 
-        snprintf(g_acValue, sizeof(g_acValue), "0x%06lX", value.uiRaw32);
-        break;
+/*----------------------------------------------------------------------------*/
+/* dumpVariable()                                                             */
+/*----------------------------------------------------------------------------*/
+int dumpVariable(const varentry_t* pVar, const uint8_t* pRaw)
+{
+  int iReturn = EOK;
 
-      default:
-        zxn_mem2hex(((uint8_t*) pVar->uiAddress), pVar->uiSize, g_acValue, sizeof(g_acValue), 1);
-    }
+  union 
+  {
+    uint8_t  uiRaw8[4];
+    uint16_t uiRaw16[2];
+    uint32_t uiRaw32;
+  } value;
 
-    zprintf(DUMP_VARNUM "-" DUMP_VARNAME " = %s\n", pVar->uiAddress, pVar->acName, g_acValue);
+  value.uiRaw32 = 0;  
 
-    switch (pVar->uiAddress)
-    {
-      case 0x5B69: /* MAXBNK */
+  switch (pVar->uiSize)
+  {
+    case 0:
+      snprintf(g_acValue, sizeof(g_acValue), "%s", "null");
+      break;
+
+    case 1:
+      value.uiRaw8[0] = pRaw[0];
+      snprintf(g_acValue, sizeof(g_acValue), "0x%02X", value.uiRaw8[0]);
+      break;
+
+    case 2:
+      value.uiRaw8[0] = pRaw[0]; 
+      value.uiRaw8[1] = pRaw[1]; 
+
+      if (0 != (pVar->uiFlags & (1 << 7))) /* ptr ? */
+      {
+        if (0 != value.uiRaw16[0]) /* NULL ? */
         {
-          uint32_t uiValue = UINT32_C(0x4000) * ((uint32_t) value.uiRaw8[0] + 1);
-          zprintf("   + " DUMP_VARSUB " = %lu (0x%lX)\n", "RAMSIZE", uiValue, uiValue);
+          snprintf(g_acValue, sizeof(g_acValue), "<%04X>", value.uiRaw16[0]);
         }
-        break;
-
-      case 0x5B79: /* LODDRV */
-      case 0x5B7A: /* SAVDRV */
-        zprintf("   + " DUMP_VARSUB " = %c\n", "DRIVE", value.uiRaw8[0]);
-        break;
-
-      case 0x5C3B: /* FLAGS */
-        zprintf("   + " DUMP_VARSUB " = %s\n", "LEADSPACE", value.uiRaw8[0] & (1 << 0) ? sKEY_DISABLED : sKEY_ENABLED);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "PRNINUSE",  value.uiRaw8[0] & (1 << 1) ? sKEY_TRUE     : sKEY_FALSE  );
-        zprintf("   + " DUMP_VARSUB " = %s\n", "PRNMODE",   value.uiRaw8[0] & (1 << 2) ? "L"           : "K"         );
-        zprintf("   + " DUMP_VARSUB " = %s\n", "KEYBMODE",  value.uiRaw8[0] & (1 << 3) ? "L"           : "K"         );
-        zprintf("   + " DUMP_VARSUB " = %s\n", "NEWKEY",    value.uiRaw8[0] & (1 << 5) ? sKEY_TRUE     : sKEY_FALSE  );
-        zprintf("   + " DUMP_VARSUB " = %s\n", "VARTYPE",   value.uiRaw8[0] & (1 << 6) ? "numeric"     : "string"    );
-        zprintf("   + " DUMP_VARSUB " = %s\n", "EXECMODE",  value.uiRaw8[0] & (1 << 7) ? "execution"   : "syn.check" );
-        break;
-
-      case 0x5C3C: /* TV-FLAG */
-        zprintf("   + " DUMP_VARSUB " = %s\n", "PRTLOWSCR", value.uiRaw8[0] & (1 << 0) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "INMODCHNG", value.uiRaw8[0] & (1 << 3) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "AUTOMLIST", value.uiRaw8[0] & (1 << 4) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "LOWSCRCLR", value.uiRaw8[0] & (1 << 5) ? sKEY_TRUE : sKEY_FALSE);
-        break;
-
-      case 0x5C41: /* MODE */
+        else
         {
-          const char_t* acModes[] = {"C|K|L", "E", "G", ""};
-          zprintf("   + " DUMP_VARSUB " = %s\n", "CURSOR", acModes[value.uiRaw8[0] & 0x03]);
+          snprintf(g_acValue, sizeof(g_acValue), "<%s>", "null");
         }
-        break;
-
-      case 0x5C48: /* BORDCR */
-        zprintf("   + " DUMP_VARSUB " = %u\n", "BORDER", (value.uiRaw8[0] >> 3) & 0x07);
-        break;
-
-      case 0x5C6A: /* FLAGS2 */
-        zprintf("   + " DUMP_VARSUB " = %s\n", "SCRNCLEAR", value.uiRaw8[0] & (1 << 0) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "PRNBFIUSE", value.uiRaw8[0] & (1 << 1) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "QUOTES",    value.uiRaw8[0] & (1 << 2) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "CAPS",      value.uiRaw8[0] & (1 << 3) ? sKEY_ON   : sKEY_OFF  );
-        zprintf("   + " DUMP_VARSUB " = %s\n", "CHNKINUSE", value.uiRaw8[0] & (1 << 4) ? sKEY_TRUE : sKEY_FALSE);
-        break;
-
-      case 0x5C7D: /* COORDS */
-        zprintf("   + " DUMP_VARSUB " = %u\n", "x", value.uiRaw8[0]);
-        zprintf("   + " DUMP_VARSUB " = %u\n", "y", value.uiRaw8[1]);
-        break;
-
-      case 0x5C8D: /* ATTR_P */
-      case 0x5C8F: /* ATTR_T */
-        zprintf("   + " DUMP_VARSUB " = %u\n", "FLASH",   value.uiRaw8[0] & (1 << 7) ? 1 : 0);
-        zprintf("   + " DUMP_VARSUB " = %u\n", "BRIGHT",  value.uiRaw8[0] & (1 << 6) ? 1 : 0);
-        zprintf("   + " DUMP_VARSUB " = %u\n", "PAPER",  (value.uiRaw8[0] >> 3) & 0x07);
-        zprintf("   + " DUMP_VARSUB " = %u\n", "INK",     value.uiRaw8[0]       & 0x07);
-        break;
-
-      case 0x5C82: /* ECHO_E  */
-      case 0x5C88: /* S_POSN  */
-      case 0x5C8A: /* S_POSNL */
-        zprintf("   + " DUMP_VARSUB " = %u\n", "COL", value.uiRaw8[0]);
-        zprintf("   + " DUMP_VARSUB " = %u\n", "ROW", value.uiRaw8[1]);
-        break;
-
-      case 0x5C91: /* P-FLAG */
-        zprintf("   + " DUMP_VARSUB " = %s\n", "OVER.TEMP", value.uiRaw8[0] & (1 << 0) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "OVER.PERM", value.uiRaw8[0] & (1 << 1) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "INV.TEMP",  value.uiRaw8[0] & (1 << 2) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "INV.PERM",  value.uiRaw8[0] & (1 << 3) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "INK9.TEMP", value.uiRaw8[0] & (1 << 4) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "INK9.PERM", value.uiRaw8[0] & (1 << 5) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "PAP9.TEMP", value.uiRaw8[0] & (1 << 6) ? sKEY_TRUE : sKEY_FALSE);
-        zprintf("   + " DUMP_VARSUB " = %s\n", "PAP9.PERM", value.uiRaw8[0] & (1 << 7) ? sKEY_TRUE : sKEY_FALSE);
-        break;
-
-      default:
-        break;
-    }
+      }
+      else
+      {
+        snprintf(g_acValue, sizeof(g_acValue), "0x%04X", value.uiRaw16[0]);
+      }
+      break;
+
+    case 3:
+      value.uiRaw8[0] = pRaw[0]; 
+      value.uiRaw8[1] = pRaw[1]; 
+      value.uiRaw8[2] = pRaw[2]; 
+      snprintf(g_acValue, sizeof(g_acValue), "0x%06lX", value.uiRaw32);
+      break;
+
+    default:
+      zxn_mem2hex((uint8_t*) pRaw, pVar->uiSize, g_acValue, sizeof(g_acValue), 1);
+  }
 
-    ++pVar;
+  zprintf(DUMP_VARNUM "-" DUMP_VARNAME " = %s\n", pVar->uiAddress, pVar->acName, g_acValue);
+
+  switch (pVar->uiAddress)
+  {
+    case 0x5B69: /* MAXBNK */
+      {
+        uint32_t uiValue = UINT32_C(0x4000) * ((uint32_t) value.uiRaw8[0] + 1);
+        zprintf("   + " DUMP_VARSUB " = %lu (0x%lX)\n", "RAMSIZE", uiValue, uiValue);
+      }
+      break;
+
+    case 0x5B79: /* LODDRV */
+    case 0x5B7A: /* SAVDRV */
+      zprintf("   + " DUMP_VARSUB " = %c\n", "DRIVE", value.uiRaw8[0]);
+      break;
+
+    case 0x5C3B: /* FLAGS */
+      zprintf("   + " DUMP_VARSUB " = %s\n", "LEADSPACE", value.uiRaw8[0] & (1 << 0) ? sKEY_DISABLED : sKEY_ENABLED);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "PRNINUSE",  value.uiRaw8[0] & (1 << 1) ? sKEY_TRUE     : sKEY_FALSE  );
+      zprintf("   + " DUMP_VARSUB " = %s\n", "PRNMODE",   value.uiRaw8[0] & (1 << 2) ? "L"           : "K"         );
+      zprintf("   + " DUMP_VARSUB " = %s\n", "KEYBMODE",  value.uiRaw8[0] & (1 << 3) ? "L"           : "K"         );
+      zprintf("   + " DUMP_VARSUB " = %s\n", "NEWKEY",    value.uiRaw8[0] & (1 << 5) ? sKEY_TRUE     : sKEY_FALSE  );
+      zprintf("   + " DUMP_VARSUB " = %s\n", "VARTYPE",   value.uiRaw8[0] & (1 << 6) ? "numeric"     : "string"    );
+      zprintf("   + " DUMP_VARSUB " = %s\n", "EXECMODE",  value.uiRaw8[0] & (1 << 7) ? "execution"   : "syn.check" );
+      break;
+
+    case 0x5C3C: /* TV-FLAG */
+      zprintf("   + " DUMP_VARSUB " = %s\n", "PRTLOWSCR", value.uiRaw8[0] & (1 << 0) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "INMODCHNG", value.uiRaw8[0] & (1 << 3) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "AUTOMLIST", value.uiRaw8[0] & (1 << 4) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "LOWSCRCLR", value.uiRaw8[0] & (1 << 5) ? sKEY_TRUE : sKEY_FALSE);
+      break;
+
+    case 0x5C41: /* MODE */
+      {
+        const char_t* acModes[] = {"C|K|L", "E", "G", ""};
+        zprintf("   + " DUMP_VARSUB " = %s\n", "CURSOR", acModes[value.uiRaw8[0] & 0x03]);
+      }
+      break;
+
+    case 0x5C48: /* BORDCR */
+      zprintf("   + " DUMP_VARSUB " = %u\n", "BORDER", (value.uiRaw8[0] >> 3) & 0x07);
+      break;
+
+    case 0x5C6A: /* FLAGS2 */
+      zprintf("   + " DUMP_VARSUB " = %s\n", "SCRNCLEAR", value.uiRaw8[0] & (1 << 0) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "PRNBFIUSE", value.uiRaw8[0] & (1 << 1) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "QUOTES",    value.uiRaw8[0] & (1 << 2) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "CAPS",      value.uiRaw8[0] & (1 << 3) ? sKEY_ON   : sKEY_OFF  );
+      zprintf("   + " DUMP_VARSUB " = %s\n", "CHNKINUSE", value.uiRaw8[0] & (1 << 4) ? sKEY_TRUE : sKEY_FALSE);
+      break;
+
+    case 0x5C7D: /* COORDS */
+      zprintf("   + " DUMP_VARSUB " = %u\n", "x", value.uiRaw8[0]);
+      zprintf("   + " DUMP_VARSUB " = %u\n", "y", value.uiRaw8[1]);
+      break;
+
+    case 0x5C8D: /* ATTR_P */
+    case 0x5C8F: /* ATTR_T */
+      zprintf("   + " DUMP_VARSUB " = %u\n", "FLASH",   value.uiRaw8[0] & (1 << 7) ? 1 : 0);
+      zprintf("   + " DUMP_VARSUB " = %u\n", "BRIGHT",  value.uiRaw8[0] & (1 << 6) ? 1 : 0);
+      zprintf("   + " DUMP_VARSUB " = %u\n", "PAPER",  (value.uiRaw8[0] >> 3) & 0x07);
+      zprintf("   + " DUMP_VARSUB " = %u\n", "INK",     value.uiRaw8[0]       & 0x07);
+      break;
+
+    case 0x5C82: /* ECHO_E  */
+    case 0x5C88: /* S_POSN  */
+    case 0x5C8A: /* S_POSNL */
+      zprintf("   + " DUMP_VARSUB " = %u\n", "COL", value.uiRaw8[0]);
+      zprintf("   + " DUMP_VARSUB " = %u\n", "ROW", value.uiRaw8[1]);
+      break;
+
+    case 0x5C91: /* P-FLAG */
+      zprintf("   + " DUMP_VARSUB " = %s\n", "OVER.TEMP", value.uiRaw8[0] & (1 << 0) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "OVER.PERM", value.uiRaw8[0] & (1 << 1) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "INV.TEMP",  value.uiRaw8[0] & (1 << 2) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "INV.PERM",  value.uiRaw8[0] & (1 << 3) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "INK9.TEMP", value.uiRaw8[0] & (1 << 4) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "INK9.PERM", value.uiRaw8[0] & (1 << 5) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "PAP9.TEMP", value.uiRaw8[0] & (1 << 6) ? sKEY_TRUE : sKEY_FALSE);
+      zprintf("   + " DUMP_VARSUB " = %s\n", "PAP9.PERM", value.uiRaw8[0] & (1 << 7) ? sKEY_TRUE : sKEY_FALSE);
+      break;
+
+    default:
+      break;
   }
 
   return iReturn;
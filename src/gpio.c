@@ -0,0 +1,386 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: gpio.c                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "raster.h"
+#include "gpio.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Number of records in a page
+*/
+#define GPIO_RECORDS (PAGE_SIZE / sizeof(gpiorec_t))
+
+/*!
+Take one sample of all GPIO inputs and store it, if it has changed
+*/
+#define GPIO_SAMPLE()                                             \
+  g_tNow.auiValue[0] = ZXN_READ_REG(0x98);                        \
+  g_tNow.auiValue[1] = ZXN_READ_REG(0x99);                        \
+  g_tNow.auiValue[2] = ZXN_READ_REG(0x9A);                        \
+  g_tNow.auiValue[3] = ZXN_READ_REG(0x9B);                        \
+  if ((g_tNow.uiValue != g_tLast.uiValue) && !gpioStore(uiTick))  \
+  {                                                               \
+    break;                                                        \
+  }                                                               \
+  ++uiTick;
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Current and previous sample of the GPIO inputs
+*/
+static union _gpiosample
+{
+  uint32_t uiValue;
+  uint8_t  auiValue[GPIO_REGS];
+} g_tNow, g_tLast;
+
+/*!
+State of a capture
+*/
+static struct _gpio
+{
+  uint8_t    auiPage[GPIO_PAGES_MAX];      /* pages of the records            */
+  uint16_t   auiRecords[GPIO_PAGES_MAX];   /* number of records per page      */
+  uint8_t    uiPageCount;                  /* number of allocated pages       */
+  uint8_t    uiPage;                       /* index of the mapped page        */
+  gpiorec_t* pRec;                         /* next record                     */
+  uint32_t   uiTicks;                      /* number of samples               */
+  uint8_t    uiFrames;                     /* frames of the capture           */
+  bool       bFull;                        /* all pages are full              */
+} g_tGpio;
+
+/*!
+Line of the VCD file
+*/
+static char_t g_acLine[0x20];
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Store the current sample as record (and switch to the next page, if the
+current page is full)
+@param uiTick Number of the sample
+@return "true" = stored; "false" = all pages are full
+*/
+static bool gpioStore(uint32_t uiTick);
+
+/*!
+Write the records as VCD file
+@param hFile     Handle of the file
+@param uiPeriod  Time between two samples (10 ns)
+@return EOK = "no error"
+*/
+static int gpioWriteVcd(uint8_t hFile, uint32_t uiPeriod);
+
+/*!
+Write a line to the VCD file
+@param hFile Handle of the file
+@return "true" = "no error"
+*/
+static bool gpioWriteLine(uint8_t hFile);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* gpioCapture()                                                              */
+/*----------------------------------------------------------------------------*/
+int gpioCapture(uint8_t uiFrames)
+{
+  int iReturn = EOK;
+  const uint8_t hFile = _dumpfile();
+  const uint16_t uiFrameTime = (ZXN_READ_REG(0x05) & (1 << 2) ? 16667 : 20000); /* us, 50/60 Hz */
+  uint32_t uiTick = 0;
+  uint32_t uiFrameTick = 0;                /* samples of the whole frames     */
+  uint32_t uiPeriod;
+  uint16_t uiLast;
+  uint16_t uiLine;
+
+  if (INV_FILE_HND == hFile)
+  {
+    return EINVAL; /* Error: no file */
+  }
+
+  if (0 == uiFrames)
+  {
+    uiFrames = GPIO_FRAMES;
+  }
+
+  memset(&g_tGpio, 0, sizeof(g_tGpio));
+
+  while ((GPIO_PAGES_MAX > g_tGpio.uiPageCount) &&
+         (PAGE_INVALID != (g_tGpio.auiPage[g_tGpio.uiPageCount] = pageAlloc())))
+  {
+    ++g_tGpio.uiPageCount;
+  }
+
+  if (0 == g_tGpio.uiPageCount)
+  {
+    return ENOMEM;
+  }
+
+  if (!_quiet())
+  {
+    printf("sampling GPIO for %u frames\n", uiFrames);
+  }
+
+  /* Interrupts are disabled while the page is mapped */
+  g_tGpio.pRec = (gpiorec_t*) pageMap(g_tGpio.auiPage[0]);
+
+  /* Start at the beginning of a frame, so the frames of the capture are whole */
+  uiLast = rasterLine();
+  while ((uiLine = rasterLine()) >= uiLast)
+  {
+    uiLast = uiLine;
+  }
+  uiLast = uiLine;
+
+  g_tNow.auiValue[0] = ZXN_READ_REG(0x98);
+  g_tNow.auiValue[1] = ZXN_READ_REG(0x99);
+  g_tNow.auiValue[2] = ZXN_READ_REG(0x9A);
+  g_tNow.auiValue[3] = ZXN_READ_REG(0x9B);
+  (void) gpioStore(0); /* initial state */
+
+  while ((0 != uiFrames) && (GPIO_TICK_MAX > uiTick) && !g_tGpio.bFull)
+  {
+    /* Unrolled: 8 samples between two checks of the scanline */
+    GPIO_SAMPLE(); GPIO_SAMPLE(); GPIO_SAMPLE(); GPIO_SAMPLE();
+    GPIO_SAMPLE(); GPIO_SAMPLE(); GPIO_SAMPLE(); GPIO_SAMPLE();
+
+    if ((uiLine = rasterLine()) < uiLast) /* new frame */
+    {
+      --uiFrames;
+      ++g_tGpio.uiFrames;
+      uiFrameTick = uiTick;
+    }
+    uiLast = uiLine;
+  }
+
+  pageUnmap();
+
+  g_tGpio.uiTicks = uiTick;
+
+  /*
+  Time between two samples in 10 ns (max. 255 frames = 5.1e8); only the
+  samples of whole frames count, the capture may stop early (pages full)
+  */
+  uiPeriod = (0 != uiFrameTick ? (((uint32_t) g_tGpio.uiFrames) * uiFrameTime * 100) / uiFrameTick : 0);
+
+  iReturn = gpioWriteVcd(hFile, uiPeriod);
+
+  if (!_quiet())
+  {
+    uint16_t uiRecords = 0;
+
+    for (uint8_t i = 0; i < g_tGpio.uiPageCount; ++i)
+    {
+      uiRecords += g_tGpio.auiRecords[i];
+    }
+
+    printf("%lu samples, %u changes\n", uiTick, uiRecords);
+    printf("%lu.%02lu us per sample%s\n", uiPeriod / 100, uiPeriod % 100, g_tGpio.bFull ? " (full)" : "");
+  }
+
+  for (uint8_t i = 0; i < g_tGpio.uiPageCount; ++i)
+  {
+    pageFree(g_tGpio.auiPage[i]);
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* gpioStore()                                                                */
+/*----------------------------------------------------------------------------*/
+static bool gpioStore(uint32_t uiTick)
+{
+  if (GPIO_RECORDS <= g_tGpio.auiRecords[g_tGpio.uiPage])
+  {
+    if ((g_tGpio.uiPage + 1) >= g_tGpio.uiPageCount)
+    {
+      g_tGpio.bFull = true;
+      return false;
+    }
+
+    pageUnmap();
+    g_tGpio.pRec = (gpiorec_t*) pageMap(g_tGpio.auiPage[++g_tGpio.uiPage]);
+  }
+
+  g_tGpio.pRec->auiTick[0] = (uint8_t) (uiTick);
+  g_tGpio.pRec->auiTick[1] = (uint8_t) (uiTick >> 8);
+  g_tGpio.pRec->auiTick[2] = (uint8_t) (uiTick >> 16);
+  memcpy(g_tGpio.pRec->auiValue, g_tNow.auiValue, GPIO_REGS);
+
+  ++g_tGpio.pRec;
+  ++g_tGpio.auiRecords[g_tGpio.uiPage];
+  g_tLast.uiValue = g_tNow.uiValue;
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* gpioWriteVcd()                                                             */
+/*----------------------------------------------------------------------------*/
+static int gpioWriteVcd(uint8_t hFile, uint32_t uiPeriod)
+{
+  int iReturn = EOK;
+  bool bOk = true;
+  uint8_t uiPin;
+
+  /* Header: one wire per pin, identifiers '!' ... */
+  snprintf(g_acLine, sizeof(g_acLine), "$timescale 10 ns $end\n");
+  bOk = bOk && gpioWriteLine(hFile);
+  snprintf(g_acLine, sizeof(g_acLine), "$scope module gpio $end\n");
+  bOk = bOk && gpioWriteLine(hFile);
+
+  for (uiPin = 0; bOk && (uiPin < GPIO_PINS); ++uiPin)
+  {
+    snprintf(g_acLine, sizeof(g_acLine), "$var wire 1 %c gpio%u $end\n", '!' + uiPin, uiPin);
+    bOk = gpioWriteLine(hFile);
+  }
+
+  snprintf(g_acLine, sizeof(g_acLine), "$upscope $end\n");
+  bOk = bOk && gpioWriteLine(hFile);
+  snprintf(g_acLine, sizeof(g_acLine), "$enddefinitions $end\n");
+  bOk = bOk && gpioWriteLine(hFile);
+
+  /* Changes: the first record holds all pins */
+  for (uint8_t i = 0; bOk && (i < g_tGpio.uiPageCount); ++i)
+  {
+    const gpiorec_t* pRec = (const gpiorec_t*) pageMap(g_tGpio.auiPage[i]);
+
+    for (uint16_t j = 0; bOk && (j < g_tGpio.auiRecords[i]); ++j, ++pRec)
+    {
+      const uint32_t uiTick = ((uint32_t) pRec->auiTick[2] << 16)
+                            | ((uint32_t) pRec->auiTick[1] << 8)
+                            | pRec->auiTick[0];
+
+      memcpy(g_tNow.auiValue, pRec->auiValue, GPIO_REGS);
+
+      if ((0 == i) && (0 == j))
+      {
+        g_tLast.uiValue = ~g_tNow.uiValue; /* all pins have "changed" */
+      }
+
+      snprintf(g_acLine, sizeof(g_acLine), "#%lu\n", uiTick * uiPeriod);
+      bOk = gpioWriteLine(hFile);
+
+      for (uiPin = 0; bOk && (uiPin < GPIO_PINS); ++uiPin)
+      {
+        const uint8_t uiMask = (1 << (uiPin & 0x07));
+
+        if ((g_tNow.auiValue[uiPin >> 3] ^ g_tLast.auiValue[uiPin >> 3]) & uiMask)
+        {
+          snprintf(g_acLine, sizeof(g_acLine), "%c%c\n", (g_tNow.auiValue[uiPin >> 3] & uiMask ? '1' : '0'), '!' + uiPin);
+          bOk = gpioWriteLine(hFile);
+        }
+      }
+
+      g_tLast.uiValue = g_tNow.uiValue;
+    }
+
+    pageUnmap();
+  }
+
+  if (bOk)
+  {
+    snprintf(g_acLine, sizeof(g_acLine), "#%lu\n", g_tGpio.uiTicks * uiPeriod);
+    bOk = gpioWriteLine(hFile);
+  }
+
+  if (!bOk)
+  {
+    iReturn = EACCES;
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* gpioWriteLine()                                                            */
+/*----------------------------------------------------------------------------*/
+static bool gpioWriteLine(uint8_t hFile)
+{
+  const uint16_t uiLen = (uint16_t) strlen(g_acLine);
+
+  return (uiLen == esx_f_write(hFile, g_acLine, uiLen));
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
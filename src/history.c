@@ -0,0 +1,485 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: history.c                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "capture.h"
+#include "page.h"
+#include "sysDrv.h"
+#include "history.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Number of captures that fit into the history page
+*/
+#define HIST_SLOTS ((uint8_t) ((PAGE_SIZE - sizeof(histhdr_t)) / sizeof(capture_t)))
+
+/*!
+File that holds the history page if the resident driver is missing
+*/
+#define HIST_PAGE_FILE "C:/TMP/SYSINFO.HPG"
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Buffers for the current and the previous capture (too big for the stack)
+*/
+static capture_t g_tCapture[2];
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Find the page that holds the history. The number of the page is kept by the
+resident driver; without driver it is kept in the file HIST_PAGE_FILE, so no
+register of the machine is changed by the history.
+@return Number of the page; PAGE_INVALID = "no history"
+*/
+static uint8_t histFindPage(void);
+
+/*!
+Remember the page that holds the history for the next call of the application
+@param uiPage Number of the page
+*/
+static void histSavePage(uint8_t uiPage);
+
+/*!
+Get the address of a slot in the mapped history page
+@param pHeader Header of the mapped page
+@param uiSlot  Index of the slot
+@return Address of the capture
+*/
+static capture_t* histSlot(histhdr_t* pHeader, uint8_t uiSlot);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* histFindPage()                                                             */
+/*----------------------------------------------------------------------------*/
+static uint8_t histFindPage(void)
+{
+  uint16_t uiPage;
+  uint8_t hFile;
+  histhdr_t* pHeader;
+
+  if (EOK != sysDrvGet(SYSDRV_FIELD_HISTPAGE, &uiPage))
+  {
+    uiPage = 0;
+
+    if (INV_FILE_HND != (hFile = esx_f_open(HIST_PAGE_FILE, ESXDOS_MODE_R | ESXDOS_MODE_OE)))
+    {
+      if (1 != esx_f_read(hFile, &uiPage, 1))
+      {
+        uiPage = 0;
+      }
+
+      esx_f_close(hFile);
+    }
+  }
+
+  if ((0 == uiPage) || (PAGE_INVALID <= uiPage))
+  {
+    return PAGE_INVALID;
+  }
+
+  pHeader = (histhdr_t*) pageMap((uint8_t) uiPage);
+  if ((0 != memcmp(pHeader->acMagic, HIST_MAGIC, sizeof(pHeader->acMagic))) ||
+      (HIST_VERSION != pHeader->uiVersion))
+  {
+    uiPage = PAGE_INVALID;
+  }
+  pageUnmap();
+
+  return (uint8_t) uiPage;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histSavePage()                                                             */
+/*----------------------------------------------------------------------------*/
+static void histSavePage(uint8_t uiPage)
+{
+  uint8_t hFile;
+
+  if (EOK != sysDrvSet(SYSDRV_FIELD_HISTPAGE, uiPage))
+  {
+    if (0 == uiPage)
+    {
+      (void) esx_f_unlink(HIST_PAGE_FILE);
+    }
+    else if (INV_FILE_HND != (hFile = esx_f_open(HIST_PAGE_FILE, ESXDOS_MODE_W | ESXDOS_MODE_CT)))
+    {
+      (void) esx_f_write(hFile, &uiPage, 1);
+      esx_f_close(hFile);
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histSlot()                                                                 */
+/*----------------------------------------------------------------------------*/
+static capture_t* histSlot(histhdr_t* pHeader, uint8_t uiSlot)
+{
+  return ((capture_t*) (pHeader + 1)) + uiSlot;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histAppend()                                                               */
+/*----------------------------------------------------------------------------*/
+int histAppend(void)
+{
+  captureTake(&g_tCapture[0]);
+  captureStamp(&g_tCapture[0]);
+
+  return histStore(&g_tCapture[0]);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histStore()                                                                */
+/*----------------------------------------------------------------------------*/
+int histStore(const capture_t* pCapture)
+{
+  int iReturn = EOK;
+  uint8_t uiPage;
+  uint8_t uiCount = 0;
+  histhdr_t* pHeader;
+  bool bNew = false;
+
+  if (PAGE_INVALID == (uiPage = histFindPage()))
+  {
+    if (PAGE_INVALID == (uiPage = pageAlloc()))
+    {
+      iReturn = ENOMEM;
+    }
+    else
+    {
+      histSavePage(uiPage);
+      bNew = true;
+    }
+  }
+
+  if (EOK == iReturn)
+  {
+    pHeader = (histhdr_t*) pageMap(uiPage);
+
+    if (bNew || (pHeader->uiRegCount != pCapture->uiRegCount))
+    {
+      memcpy(pHeader->acMagic, HIST_MAGIC, sizeof(pHeader->acMagic));
+      pHeader->uiVersion  = HIST_VERSION;
+      pHeader->uiRegCount = pCapture->uiRegCount;
+      pHeader->uiCount    = 0;
+      pHeader->uiNext     = 0;
+    }
+
+    memcpy(histSlot(pHeader, pHeader->uiNext), pCapture, sizeof(capture_t));
+
+    pHeader->uiNext = (pHeader->uiNext + 1) % HIST_SLOTS;
+    if (pHeader->uiCount < HIST_SLOTS)
+    {
+      ++pHeader->uiCount;
+    }
+    uiCount = pHeader->uiCount;
+
+    pageUnmap();
+
+    zprintf("capture %u/%u stored in page %u\n", uiCount, HIST_SLOTS, uiPage);
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histList()                                                                 */
+/*----------------------------------------------------------------------------*/
+int histList(void)
+{
+  int iReturn = EOK;
+  uint8_t uiPage;
+  uint8_t uiCount;
+  uint8_t uiFirst;
+  histhdr_t* pHeader;
+
+  zheader("CAPTURE HISTORY");
+
+  if (PAGE_INVALID == (uiPage = histFindPage()))
+  {
+    iReturn = EBADF; /* Error: no history */
+  }
+
+  if (EOK == iReturn)
+  {
+    pHeader = (histhdr_t*) pageMap(uiPage);
+    uiCount = pHeader->uiCount;
+    uiFirst = (pHeader->uiNext + HIST_SLOTS - uiCount) % HIST_SLOTS;
+    pageUnmap();
+
+    zprintf("NR TIME       FRAMES CHANGES\n");
+
+    for (uint8_t i = 0; i < uiCount; ++i)
+    {
+      capture_t* pCurr = &g_tCapture[i & 0x01];
+      capture_t* pPrev = &g_tCapture[(i + 1) & 0x01];
+      struct dos_tm tRaw;
+      struct tm tTime;
+
+      pHeader = (histhdr_t*) pageMap(uiPage);
+      memcpy(pCurr, histSlot(pHeader, (uiFirst + i) % HIST_SLOTS), sizeof(capture_t));
+      pageUnmap();
+
+      tRaw.date = pCurr->uiDosDate;
+      tRaw.time = pCurr->uiDosTime;
+      tm_from_dostm(&tTime, &tRaw);
+
+      if (0 == i)
+      {
+        zprintf(DUMP_HISTNUM " %02u:%02u:%02u %8lu       -\n", i,
+                tTime.tm_hour, tTime.tm_min, tTime.tm_sec,
+                captureFrames(pCurr));
+      }
+      else
+      {
+        zprintf(DUMP_HISTNUM " %02u:%02u:%02u %8lu %7u\n", i,
+                tTime.tm_hour, tTime.tm_min, tTime.tm_sec,
+                captureFrames(pCurr),
+                captureChanges(pPrev, pCurr));
+      }
+    }
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histFlush()                                                                */
+/*----------------------------------------------------------------------------*/
+int histFlush(void)
+{
+  int iReturn = EOK;
+  uint8_t uiPage;
+  uint16_t uiSize;
+  histhdr_t* pHeader;
+
+  if (INV_FILE_HND == _dumpfile())
+  {
+    iReturn = EINVAL; /* Error: no file */
+  }
+  else if (PAGE_INVALID == (uiPage = histFindPage()))
+  {
+    iReturn = EBADF; /* Error: no history */
+  }
+
+  if (EOK == iReturn)
+  {
+    pHeader = (histhdr_t*) pageMap(uiPage);
+
+    /* Slots are filled from the start, so the used part is one block */
+    uiSize = sizeof(histhdr_t) + (pHeader->uiCount * sizeof(capture_t));
+
+    if (uiSize != esx_f_write(_dumpfile(), pHeader, uiSize))
+    {
+      iReturn = EACCES;
+    }
+    else
+    {
+      pHeader->uiCount = 0;
+      pHeader->uiNext  = 0;
+    }
+
+    pageUnmap();
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histSave()                                                                 */
+/*----------------------------------------------------------------------------*/
+int histSave(void)
+{
+  int iReturn = EOK;
+  histhdr_t tHeader;
+
+  if (INV_FILE_HND == _dumpfile())
+  {
+    iReturn = EINVAL; /* Error: no file */
+  }
+
+  if (EOK == iReturn)
+  {
+    captureTake(&g_tCapture[0]);
+    captureStamp(&g_tCapture[0]);
+
+    memcpy(tHeader.acMagic, HIST_MAGIC, sizeof(tHeader.acMagic));
+    tHeader.uiVersion  = HIST_VERSION;
+    tHeader.uiRegCount = g_tCapture[0].uiRegCount;
+    tHeader.uiCount    = 1;
+    tHeader.uiNext     = 1;
+
+    if ((sizeof(tHeader) != esx_f_write(_dumpfile(), &tHeader, sizeof(tHeader))) ||
+        (sizeof(capture_t) != esx_f_write(_dumpfile(), &g_tCapture[0], sizeof(capture_t))))
+    {
+      iReturn = EACCES;
+    }
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histLoad()                                                                 */
+/*----------------------------------------------------------------------------*/
+int histLoad(const char_t* acPathName, capture_t* pCapture)
+{
+  int iReturn = EOK;
+  uint8_t hFile;
+  uint8_t uiNewest;
+  histhdr_t tHeader;
+
+  if (INV_FILE_HND == (hFile = esx_f_open(acPathName, ESXDOS_MODE_R | ESXDOS_MODE_OE)))
+  {
+    return EBADF;
+  }
+
+  if ((sizeof(tHeader) != esx_f_read(hFile, &tHeader, sizeof(tHeader))) ||
+      (0 != memcmp(tHeader.acMagic, HIST_MAGIC, sizeof(tHeader.acMagic))))
+  {
+    iReturn = ENOTSUP; /* no binary capture */
+  }
+
+  if (EOK == iReturn)
+  {
+    captureTake(&g_tCapture[0]);
+
+    if ((HIST_VERSION != tHeader.uiVersion)                   ||
+        (tHeader.uiRegCount != g_tCapture[0].uiRegCount)      ||
+        (0 == tHeader.uiCount))
+    {
+      iReturn = EINVAL; /* Error: incompatible capture */
+    }
+  }
+
+  if (EOK == iReturn)
+  {
+    /* The slot before "uiNext" holds the newest capture of the ring buffer */
+    uiNewest = (0 != tHeader.uiNext ? tHeader.uiNext : tHeader.uiCount) - 1;
+
+    esx_f_seek(hFile, sizeof(histhdr_t) + ((uint32_t) uiNewest * sizeof(capture_t)), ESX_SEEK_SET);
+
+    if (sizeof(capture_t) != esx_f_read(hFile, pCapture, sizeof(capture_t)))
+    {
+      iReturn = EINVAL;
+    }
+  }
+
+  esx_f_close(hFile);
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* histRelease()                                                              */
+/*----------------------------------------------------------------------------*/
+int histRelease(void)
+{
+  int iReturn = EOK;
+  uint8_t uiPage;
+  histhdr_t* pHeader;
+
+  if (PAGE_INVALID == (uiPage = histFindPage()))
+  {
+    iReturn = EBADF; /* Error: no history */
+  }
+
+  if (EOK == iReturn)
+  {
+    pHeader = (histhdr_t*) pageMap(uiPage);
+    memset(pHeader, 0, sizeof(histhdr_t));
+    pageUnmap();
+
+    pageFree(uiPage);
+    histSavePage(0);
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
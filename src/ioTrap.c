@@ -0,0 +1,327 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: ioTrap.c                                                           |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "page.h"
+#include "sysDrv.h"
+#include "ioTrap.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Number of known trap causes (NR 0xDA); all others are counted as "OTHER"
+*/
+#define IOTRAP_CAUSES (4)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Names of the trap causes (NR 0xDA)
+*/
+static const char_t* g_acCauseNames[IOTRAP_CAUSES + 1] =
+{
+  "NONE",
+  "2FFD RD",
+  "3FFD RD",
+  "3FFD WR",
+  "OTHER"
+};
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Statistics of all records of the I/O trap page
+*/
+static struct _iotrapstat
+{
+  uint16_t uiRecords;                      /* number of records               */
+  uint16_t uiPeak;                         /* max. records in one frame       */
+  uint32_t uiFirst;                        /* FRAMES of the first record      */
+  uint32_t uiLast;                         /* FRAMES of the last record       */
+  uint16_t auiCause[IOTRAP_CAUSES + 1];    /* records by cause                */
+  uint8_t  uiPCCount;                      /* used entries of "tPC"           */
+  uint16_t uiPCOther;                      /* records of callers not in "tPC" */
+  struct
+  {
+    uint16_t uiPC;
+    uint16_t uiCount;
+  } tPC[IOTRAP_PCS_MAX];                   /* records by caller               */
+} g_tTrap;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Count all records of the (mapped) I/O trap page
+@param pLog Header of the page
+*/
+static void ioTrapScan(const iotrap_t* pLog);
+
+/*!
+Show the statistics of the records
+*/
+static void ioTrapReport(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* ioTrapShow()                                                               */
+/*----------------------------------------------------------------------------*/
+int ioTrapShow(void)
+{
+  uint16_t uiPageValue;
+  uint8_t uiPage = PAGE_INVALID;
+  iotrap_t* pLog;
+
+  if (!sysDrvPresent())
+  {
+    fprintf(stderr, "driver not installed (.install sysinfo.drv)\n");
+    return ENOTSUP;
+  }
+
+  zheader("I/O TRAPS");
+
+  if ((EOK == sysDrvGet(SYSDRV_FIELD_TRAPPAGE, &uiPageValue)) && (0 != uiPageValue))
+  {
+    uiPage = (uint8_t) uiPageValue;
+  }
+  else if (PAGE_INVALID == (uiPage = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  memset(&g_tTrap, 0, sizeof(g_tTrap));
+
+  pLog = (iotrap_t*) pageMap(uiPage);
+
+  if (0 == memcmp(pLog->acMagic, IOTRAP_MAGIC, sizeof(pLog->acMagic)))
+  {
+    ioTrapScan(pLog);
+  }
+
+  /* Empty log for the next records */
+  memset(pLog, 0, sizeof(iotrap_t));
+  memcpy(pLog->acMagic, IOTRAP_MAGIC, sizeof(pLog->acMagic));
+  pLog->uiVersion = IOTRAP_VERSION;
+  pLog->uiNext    = IOTRAP_FIRST;
+
+  pageUnmap();
+
+  (void) sysDrvSet(SYSDRV_FIELD_TRAPPAGE, uiPage);
+
+  if (0 != g_tTrap.uiRecords)
+  {
+    ioTrapReport();
+  }
+  else
+  {
+    zprintf("no traps recorded yet\n");
+  }
+
+  zprintf("%s (page %u)\n", (ZXN_READ_REG(0xD8) & 0x01 ? "armed" : "not armed"), uiPage);
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* ioTrapDisarm()                                                             */
+/*----------------------------------------------------------------------------*/
+int ioTrapDisarm(void)
+{
+  uint16_t uiPageValue;
+
+  ZXN_WRITE_REG(0xD8, ZXN_READ_REG(0xD8) & ~0x01); /* +3 FDC traps */
+
+  if ((EOK == sysDrvGet(SYSDRV_FIELD_TRAPPAGE, &uiPageValue)) && (0 != uiPageValue))
+  {
+    (void) sysDrvSet(SYSDRV_FIELD_TRAPPAGE, 0);
+    pageFree((uint8_t) uiPageValue);
+  }
+
+  zprintf("I/O traps disarmed\n");
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* ioTrapScan()                                                               */
+/*----------------------------------------------------------------------------*/
+static void ioTrapScan(const iotrap_t* pLog)
+{
+  const iotraprec_t* pRec = (const iotraprec_t*) (((const uint8_t*) pLog) + IOTRAP_FIRST);
+  const iotraprec_t* pEnd = (const iotraprec_t*) (((const uint8_t*) pLog) + pLog->uiNext);
+  uint16_t uiRun = 0;
+
+  while (pRec < pEnd)
+  {
+    const uint32_t uiFrames = ((uint32_t) pRec->auiFrames[2] << 16)
+                            | ((uint32_t) pRec->auiFrames[1] << 8)
+                            | pRec->auiFrames[0];
+    uint8_t i;
+
+    /* Time: records per frame */
+    if ((0 == g_tTrap.uiRecords) || (uiFrames != g_tTrap.uiLast))
+    {
+      uiRun = 0;
+    }
+
+    if (0 == g_tTrap.uiRecords)
+    {
+      g_tTrap.uiFirst = uiFrames;
+    }
+
+    g_tTrap.uiLast = uiFrames;
+
+    if (++uiRun > g_tTrap.uiPeak)
+    {
+      g_tTrap.uiPeak = uiRun;
+    }
+
+    /* Port */
+    ++g_tTrap.auiCause[pRec->uiCause < IOTRAP_CAUSES ? pRec->uiCause : IOTRAP_CAUSES];
+
+    /* Caller */
+    for (i = 0; i < g_tTrap.uiPCCount; ++i)
+    {
+      if (g_tTrap.tPC[i].uiPC == pRec->uiPC)
+      {
+        break;
+      }
+    }
+
+    if (i < g_tTrap.uiPCCount)
+    {
+      ++g_tTrap.tPC[i].uiCount;
+    }
+    else if (IOTRAP_PCS_MAX > g_tTrap.uiPCCount)
+    {
+      g_tTrap.tPC[i].uiPC    = pRec->uiPC;
+      g_tTrap.tPC[i].uiCount = 1;
+      ++g_tTrap.uiPCCount;
+    }
+    else
+    {
+      ++g_tTrap.uiPCOther;
+    }
+
+    ++g_tTrap.uiRecords;
+    ++pRec;
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* ioTrapReport()                                                             */
+/*----------------------------------------------------------------------------*/
+static void ioTrapReport(void)
+{
+  const uint32_t uiSpan = g_tTrap.uiLast - g_tTrap.uiFirst + 1;
+  const uint8_t  uiRate = (ZXN_READ_REG(0x05) & (1 << 2) ? 60 : 50); /* 50/60 Hz */
+
+  zprintf(DUMP_TRAPNAME " = %u\n", "ACCESSES", g_tTrap.uiRecords);
+  zprintf(DUMP_TRAPNAME " = %lu\n", "FRAMES", uiSpan);
+  zprintf(DUMP_TRAPNAME " = %lu/s\n", "RATE", (((uint32_t) g_tTrap.uiRecords) * uiRate) / uiSpan);
+  zprintf(DUMP_TRAPNAME " = %u/frame\n", "PEAK", g_tTrap.uiPeak);
+
+  for (uint8_t i = 0; i <= IOTRAP_CAUSES; ++i)
+  {
+    if (0 != g_tTrap.auiCause[i])
+    {
+      zprintf(DUMP_TRAPNAME " = %u\n", g_acCauseNames[i], g_tTrap.auiCause[i]);
+    }
+  }
+
+  /* Callers: sort by count (descending) */
+  for (uint8_t i = 1; i < g_tTrap.uiPCCount; ++i)
+  {
+    for (uint8_t j = i; (0 < j) && (g_tTrap.tPC[j - 1].uiCount < g_tTrap.tPC[j].uiCount); --j)
+    {
+      const uint16_t uiPC    = g_tTrap.tPC[j].uiPC;
+      const uint16_t uiCount = g_tTrap.tPC[j].uiCount;
+
+      g_tTrap.tPC[j]             = g_tTrap.tPC[j - 1];
+      g_tTrap.tPC[j - 1].uiPC    = uiPC;
+      g_tTrap.tPC[j - 1].uiCount = uiCount;
+    }
+  }
+
+  for (uint8_t i = 0; (i < g_tTrap.uiPCCount) && (i < IOTRAP_TOP); ++i)
+  {
+    zprintf("PC 0x%04X = %u\n", g_tTrap.tPC[i].uiPC, g_tTrap.tPC[i].uiCount);
+  }
+
+  if (0 != g_tTrap.uiPCOther)
+  {
+    zprintf(DUMP_TRAPNAME " = %u\n", "OTHER PC", g_tTrap.uiPCOther);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,238 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: irqLoad.c                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <intrinsic.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "raster.h"
+#include "irqLoad.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Number of interrupt status registers (NR 0xC8 - 0xCA)
+*/
+#define IRQLOAD_REGS (3)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+All interrupt sources that are counted
+*/
+static const irqsource_t g_tSources[] =
+{
+  {0, 0, "ULA"        },
+  {0, 1, "LINE"       },
+  {1, 0, "CTCCHN0ZCTO"},
+  {1, 1, "CTCCHN1ZCTO"},
+  {1, 2, "CTCCHN2ZCTO"},
+  {1, 3, "CTCCHN3ZCTO"},
+  {1, 4, "CTCCHN4ZCTO"},
+  {1, 5, "CTCCHN5ZCTO"},
+  {1, 6, "CTCCHN6ZCTO"},
+  {1, 7, "CTCCHN7ZCTO"},
+  {2, 0, "UART0RXAVIL"},
+  {2, 1, "UART0RXNFUL"},
+  {2, 2, "UART0TXEMPT"},
+  {2, 4, "UART1RXAVIL"},
+  {2, 5, "UART1RXNFUL"},
+  {2, 6, "UART1TXEMPT"},
+  /* ---------------------- */
+  {0, 0, NULL         }
+};
+
+/*!
+Number of interrupts of each bit of the status registers (first and second
+window)
+*/
+static uint16_t g_auiCount[2][IRQLOAD_REGS][8];
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Poll the interrupt status registers for a number of frames. The frames are
+counted with the video line, so this works with disabled interrupts, too.
+The nregs are read and cleared with disabled interrupts, so no handler can
+change the nreg selection in between.
+@param uiFrames Length of the window in frames
+@param pCount   Counters of all bits of the status registers
+@param bIrq     true = interrupts are enabled between the reads
+@return Number of loops (measure of the free CPU time)
+*/
+static uint32_t irqLoadPoll(uint16_t uiFrames, uint16_t pCount[IRQLOAD_REGS][8], bool bIrq);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dumpInterruptLoad()                                                        */
+/*----------------------------------------------------------------------------*/
+int dumpInterruptLoad(uint8_t uiSeconds)
+{
+  int iReturn = EOK;
+  uint32_t uiLoopsDI;
+  uint32_t uiLoopsEI;
+  uint16_t uiLoad;
+  const uint8_t uiRate = (ZXN_READ_REG(0x05) & (1 << 2) ? 60 : 50); /* 50/60 Hz */
+  const uint16_t uiFrames = ((uint16_t) uiSeconds) * uiRate;
+
+  if ((0 == uiSeconds) || (IRQLOAD_WINDOW_MAX < uiSeconds))
+  {
+    return EINVAL;
+  }
+
+  zheader("INTERRUPT LOAD (%u S)", uiSeconds);
+
+  memset(g_auiCount, 0, sizeof(g_auiCount));
+
+  /*
+  First window: Interrupts are disabled, so no handler takes any CPU time and
+  every source that fires is counted by its status bit. Second window: The
+  same loop with enabled interrupts runs slower by the time of the handlers.
+  */
+  intrinsic_di();
+  uiLoopsDI = irqLoadPoll(uiFrames, g_auiCount[0], false);
+  uiLoopsEI = irqLoadPoll(uiFrames, g_auiCount[1], true);
+  intrinsic_ei();
+
+  for (uint8_t i = 0; 0 != g_tSources[i].acName; ++i)
+  {
+    const uint16_t uiCount = g_auiCount[0][g_tSources[i].uiReg][g_tSources[i].uiBit];
+
+    if (0 != uiCount)
+    {
+      zprintf(DUMP_IRQNAME " = %5u/s\n", g_tSources[i].acName, uiCount / uiSeconds);
+    }
+  }
+
+  /* Only the sum of all handlers is measured, not the share of each source */
+  uiLoad = ((uiLoopsDI > uiLoopsEI) && (10 <= uiLoopsDI) ? (uint16_t) (((uiLoopsDI - uiLoopsEI) * 100) / (uiLoopsDI / 10)) : 0);
+  zprintf(DUMP_IRQNAME " = %3u.%u %%\n", "CPULOAD", uiLoad / 10, uiLoad % 10);
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* irqLoadPoll()                                                              */
+/*----------------------------------------------------------------------------*/
+static uint32_t irqLoadPoll(uint16_t uiFrames, uint16_t pCount[IRQLOAD_REGS][8], bool bIrq)
+{
+  uint32_t uiLoops = 0;
+  uint16_t uiLast;
+  uint16_t uiLine;
+  uint8_t  auiStatus[IRQLOAD_REGS];
+
+  for (uint8_t i = 0; i < IRQLOAD_REGS; ++i)
+  {
+    ZXN_WRITE_REG(0xC8 + i, 0xFF); /* clear all status bits */
+  }
+
+  uiLast = rasterLine();
+
+  while (0 != uiFrames)
+  {
+    intrinsic_di();
+
+    for (uint8_t i = 0; i < IRQLOAD_REGS; ++i)
+    {
+      if (0 != (auiStatus[i] = ZXN_READ_REG(0xC8 + i)))
+      {
+        ZXN_WRITE_REG(0xC8 + i, auiStatus[i]); /* clear the bits that are set */
+
+        for (uint8_t j = 0; j < 8; ++j)
+        {
+          if (auiStatus[i] & (1 << j))
+          {
+            ++pCount[i][j];
+          }
+        }
+      }
+    }
+
+    if ((uiLine = rasterLine()) < uiLast) /* new frame */
+    {
+      --uiFrames;
+    }
+    uiLast = uiLine;
+
+    if (bIrq)
+    {
+      intrinsic_ei(); /* pending interrupts are taken here */
+    }
+
+    ++uiLoops;
+  }
+
+  return uiLoops;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
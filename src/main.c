@@ -51,6 +51,29 @@
 #include "dumpDos.h"
 #include "dumpRegs.h"
 #include "dumpVars.h"
+#include "sysDrv.h"
+#include "history.h"
+#include "diff.h"
+#include "apply.h"
+#include "watch.h"
+#include "dash.h"
+#include "raster.h"
+#include "trigger.h"
+#include "bglog.h"
+#include "snap.h"
+#include "irqLoad.h"
+#include "ioTrap.h"
+#include "gpio.h"
+#include "benchCopy.h"
+#include "benchDma.h"
+#include "benchCpu.h"
+#include "benchCont.h"
+#include "benchVideo.h"
+#include "benchLat.h"
+#include "benchSd.h"
+#include "benchSdLat.h"
+#include "benchOs.h"
+#include "benchGfx.h"
 #include "version.h"
 
 /*============================================================================*/
@@ -94,10 +117,60 @@ static struct _state
   */
   bool bQuiet;
 
+  /*!
+  If this flag is set, the dump file is saved as raw binary capture
+  */
+  bool bBinary;
+
+  /*!
+  If this flag is set, the nregs are shown as compact matrix of raw values
+  */
+  bool bCompact;
+
+  /*!
+  If this flag is set, the I/O traps are disarmed (option "-o 0")
+  */
+  bool bTrapOff;
+
+  /*!
+  Pathname of the previous capture to compare with (option "-d")
+  */
+  const char_t* acDiffFile;
+
+  /*!
+  Pathname of the capture to restore the configuration from (option "-a")
+  */
+  const char_t* acApplyFile;
+
+  /*!
+  Number of frames between two captures/updates (options "-w" and "-p")
+  */
+  uint8_t uiWatchFrames;
+
+  /*!
+  Length of a GPIO capture in frames (option "-L", 0 = default)
+  */
+  uint8_t uiLogicFrames;
+
+  /*!
+  Length of the interrupt load window in seconds (option "-i")
+  */
+  uint8_t uiIrqSeconds;
+
+  /*!
+  Drive of the storage benchmarks (option "-D", '\0' = current drive)
+  */
+  char_t cBenchDrive;
+
+  /*!
+  Configuration of the background log (option "-B")
+  */
+  const char_t* acBgLog;
+
   /*!
   Bitmasked list of features to show
   */
-  uint8_t uiFeatures;
+  uint16_t uiFeatures;
 
   /*!
   Backup: Current speed of Z80
@@ -133,6 +206,21 @@ static struct _state
     Handle of the file that's used to save the output
     */
     uint8_t hFile;
+
+    /*!
+    If set, all output is collected in this buffer instead of being printed
+    */
+    char_t* acSink;
+
+    /*!
+    Size of the buffer "acSink"
+    */
+    uint16_t uiSinkSize;
+
+    /*!
+    Number of characters collected in "acSink"
+    */
+    uint16_t uiSinkLen;
   } dump;
 
 } g_tState;
@@ -182,6 +270,19 @@ Read, detect and show system information
 */
 int dumpSystemInfo(void);
 
+/*!
+Open the dump file given on the command line. If the argument is a directory,
+a new file with a default name is created.
+@param acExt Extension of the default name ("txt", "bin", ...)
+@return EOK = "no error" (also if no file is given)
+*/
+int openDumpFile(const char_t* acExt);
+
+/*!
+Close the dump file (if open)
+*/
+void closeDumpFile(void);
+
 /*============================================================================*/
 /*                               Klassen                                      */
 /*============================================================================*/
@@ -198,7 +299,18 @@ void _construct(void)
   g_tState.eAction       = ACTION_NONE;
   g_tState.bForce        = false;
   g_tState.bQuiet        = false;
-  g_tState.uiFeatures    = 0xFF;
+  g_tState.bBinary       = false;
+  g_tState.bCompact      = false;
+  g_tState.bTrapOff      = false;
+  g_tState.acDiffFile    = 0;
+  g_tState.acApplyFile   = 0;
+  g_tState.uiWatchFrames = 1;
+  g_tState.uiLogicFrames = 0;
+  g_tState.uiIrqSeconds  = IRQLOAD_WINDOW;
+  g_tState.cBenchDrive   = '\0';
+  g_tState.acBgLog       = 0;
+  g_tState.dump.acSink   = 0;
+  g_tState.uiFeatures    = FEATURE_DEFAULT;
   g_tState.uiCpuSpeed    = zxn_getspeed();
   g_tState.dump.acPathName[0] = '\0';
   g_tState.dump.hFile    = INV_FILE_HND;
@@ -256,6 +368,95 @@ int main(int argc, char* argv[])
       case ACTION_DUMP:
         g_tState.iExitCode = dumpSystemInfo();
         break;
+
+      case ACTION_DRIVER:
+        g_tState.iExitCode = sysDrvStore();
+        break;
+
+      case ACTION_KEEP:
+        g_tState.iExitCode = histAppend();
+        break;
+
+      case ACTION_LIST:
+        g_tState.iExitCode = histList();
+        break;
+
+      case ACTION_FLUSH:
+        if (EOK == (g_tState.iExitCode = openDumpFile("bin")))
+        {
+          /* The background log has priority over the history */
+          g_tState.iExitCode = (bglogActive() ? bglogFlush() : histFlush());
+        }
+        closeDumpFile();
+        break;
+
+      case ACTION_RELEASE:
+        g_tState.iExitCode = histRelease();
+        break;
+
+      case ACTION_DIFF:
+        if (EOK == (g_tState.iExitCode = openDumpFile("txt")))
+        {
+          g_tState.iExitCode = diffCapture(g_tState.acDiffFile);
+        }
+        closeDumpFile();
+        break;
+
+      case ACTION_APPLY:
+        g_tState.iExitCode = applyCapture(g_tState.acApplyFile);
+        break;
+
+      case ACTION_WATCH:
+        if (g_tState.bBinary && (0 == g_tState.dump.acPathName[0]))
+        {
+          g_tState.iExitCode = EINVAL; /* Error: stream needs a file */
+        }
+        else if (EOK == (g_tState.iExitCode = openDumpFile(g_tState.bBinary ? "bin" : "txt")))
+        {
+          g_tState.iExitCode = watchCapture(g_tState.uiWatchFrames, g_tState.bBinary);
+        }
+        closeDumpFile();
+        break;
+
+      case ACTION_PANEL:
+        g_tState.iExitCode = dashShow(g_tState.uiWatchFrames);
+        break;
+
+      case ACTION_BGLOG:
+        g_tState.iExitCode = bglogStart(g_tState.acBgLog);
+        break;
+
+      case ACTION_SNAP:
+        g_tState.iExitCode = snapArm();
+        break;
+
+      case ACTION_GPIO:
+        if (0 == g_tState.dump.acPathName[0])
+        {
+          g_tState.iExitCode = EINVAL; /* Error: VCD needs a file */
+        }
+        else if (EOK == (g_tState.iExitCode = openDumpFile("vcd")))
+        {
+          g_tState.iExitCode = gpioCapture(g_tState.uiLogicFrames);
+        }
+        closeDumpFile();
+        break;
+
+      case ACTION_IOTRAP:
+        if (EOK == (g_tState.iExitCode = openDumpFile("txt")))
+        {
+          g_tState.iExitCode = (g_tState.bTrapOff ? ioTrapDisarm() : ioTrapShow());
+        }
+        closeDumpFile();
+        break;
+
+      case ACTION_RASTER:
+        if (EOK == (g_tState.iExitCode = openDumpFile("txt")))
+        {
+          g_tState.iExitCode = rasterProfile();
+        }
+        closeDumpFile();
+        break;
     }
   }
 
@@ -296,13 +497,198 @@ int parseArguments(int argc, char_t* argv[])
       {
         g_tState.bQuiet = true;
       }
+      else if ((0 == strcmp(acArg, "-s")) || (0 == stricmp(acArg, "--store")))
+      {
+        g_tState.eAction = ACTION_DRIVER;
+      }
+      else if ((0 == strcmp(acArg, "-k")) || (0 == stricmp(acArg, "--keep")))
+      {
+        g_tState.eAction = ACTION_KEEP;
+      }
+      else if ((0 == strcmp(acArg, "-l")) || (0 == stricmp(acArg, "--list")))
+      {
+        g_tState.eAction = ACTION_LIST;
+      }
+      else if ((0 == strcmp(acArg, "-x")) || (0 == stricmp(acArg, "--flush")))
+      {
+        g_tState.eAction = ACTION_FLUSH;
+      }
+      else if (0 == stricmp(acArg, "--release"))
+      {
+        g_tState.eAction = ACTION_RELEASE;
+      }
+      else if ((0 == strcmp(acArg, "-b")) || (0 == stricmp(acArg, "--binary")))
+      {
+        g_tState.bBinary = true;
+      }
+      else if ((0 == strcmp(acArg, "-c")) || (0 == stricmp(acArg, "--compact")))
+      {
+        g_tState.bCompact = true;
+      }
+      else if ((0 == strcmp(acArg, "-d")) || (0 == stricmp(acArg, "--diff")))
+      {
+        if ((i + 1) < argc)
+        {
+          g_tState.acDiffFile = argv[i + 1];
+          g_tState.eAction = ACTION_DIFF;
+          ++i;
+        }
+        else
+        {
+          fprintf(stderr, "missing file: %s\n", acArg);
+          iReturn = EINVAL;
+          break;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-a")) || (0 == stricmp(acArg, "--apply")))
+      {
+        if ((i + 1) < argc)
+        {
+          g_tState.acApplyFile = argv[i + 1];
+          g_tState.eAction = ACTION_APPLY;
+          ++i;
+        }
+        else
+        {
+          fprintf(stderr, "missing file: %s\n", acArg);
+          iReturn = EINVAL;
+          break;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-w")) || (0 == stricmp(acArg, "--watch")))
+      {
+        g_tState.eAction = ACTION_WATCH;
+
+        if (((i + 1) < argc) && isdigit(argv[i + 1][0]))
+        {
+          g_tState.uiWatchFrames = (uint8_t) atoi(argv[i + 1]);
+          ++i;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-p")) || (0 == stricmp(acArg, "--panel")))
+      {
+        g_tState.eAction = ACTION_PANEL;
+
+        if (((i + 1) < argc) && isdigit(argv[i + 1][0]))
+        {
+          g_tState.uiWatchFrames = (uint8_t) atoi(argv[i + 1]);
+          ++i;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-n")) || (0 == stricmp(acArg, "--nmi")))
+      {
+        g_tState.eAction = ACTION_SNAP;
+      }
+      else if ((0 == strcmp(acArg, "-L")) || (0 == stricmp(acArg, "--logic")))
+      {
+        g_tState.eAction = ACTION_GPIO;
+
+        if (((i + 1) < argc) && isdigit(argv[i + 1][0]))
+        {
+          g_tState.uiLogicFrames = (uint8_t) atoi(argv[i + 1]);
+          ++i;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-i")) || (0 == stricmp(acArg, "--irqwin")))
+      {
+        const uint32_t uiSeconds = (((i + 1) < argc) && isdigit(argv[i + 1][0]) ? strtoul(argv[i + 1], 0, 10) : 0);
+
+        if ((0 == uiSeconds) || (IRQLOAD_WINDOW_MAX < uiSeconds))
+        {
+          fprintf(stderr, "invalid window: %s\n", acArg);
+          iReturn = EINVAL;
+          break;
+        }
+
+        g_tState.uiIrqSeconds = (uint8_t) uiSeconds;
+        ++i;
+      }
+      else if ((0 == strcmp(acArg, "-D")) || (0 == stricmp(acArg, "--drive")))
+      {
+        if (((i + 1) < argc) && isalpha(argv[i + 1][0]))
+        {
+          g_tState.cBenchDrive = toupper(argv[i + 1][0]);
+          ++i;
+        }
+        else
+        {
+          fprintf(stderr, "missing drive: %s\n", acArg);
+          iReturn = EINVAL;
+          break;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-o")) || (0 == stricmp(acArg, "--iotrap")))
+      {
+        g_tState.eAction = ACTION_IOTRAP;
+
+        if (((i + 1) < argc) && (0 == strcmp(argv[i + 1], "0")))
+        {
+          g_tState.bTrapOff = true;
+          ++i;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-B")) || (0 == stricmp(acArg, "--background")))
+      {
+        if ((i + 1) < argc)
+        {
+          g_tState.acBgLog = argv[i + 1];
+          g_tState.eAction = ACTION_BGLOG;
+          ++i;
+        }
+        else
+        {
+          fprintf(stderr, "missing rate: %s\n", acArg);
+          iReturn = EINVAL;
+          break;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-g")) || (0 == stricmp(acArg, "--trigger")))
+      {
+        if ((i + 1) < argc)
+        {
+          if (EOK != (iReturn = trigCompile(argv[i + 1])))
+          {
+            fprintf(stderr, "invalid trigger: %s\n", argv[i + 1]);
+            break;
+          }
+
+          g_tState.eAction = ACTION_WATCH;
+          ++i;
+        }
+        else
+        {
+          fprintf(stderr, "missing trigger: %s\n", acArg);
+          iReturn = EINVAL;
+          break;
+        }
+      }
+      else if ((0 == strcmp(acArg, "-r")) || (0 == stricmp(acArg, "--raster")))
+      {
+        if ((i + 1) < argc)
+        {
+          if (EOK != (iReturn = rasterParse(argv[i + 1])))
+          {
+            fprintf(stderr, "invalid lines: %s\n", argv[i + 1]);
+            break;
+          }
+
+          g_tState.eAction = ACTION_RASTER;
+          ++i;
+        }
+        else
+        {
+          fprintf(stderr, "missing lines: %s\n", acArg);
+          iReturn = EINVAL;
+          break;
+        }
+      }
       else if ((0 == stricmp(acArg, "-t")) || (0 == stricmp(acArg, "--topic")))
       {
         if ((i + 1) < argc)
         {
           const char_t* acNextArg = argv[i + 1];
           const uint8_t uiArgLen = strlen(acNextArg);
-          uint8_t uiFeatures = 0;
+          uint16_t uiFeatures = 0;
 
           DBGPRINTF("parseArgs() - narg=%s; nlen=%u\n", acNextArg, uiArgLen);
 
@@ -314,9 +700,20 @@ int parseArguments(int argc, char_t* argv[])
 
             switch (cTopic)
             {
-              case 'r': uiFeatures |= ((uint8_t) FEATURE_REGISTERS); break;
-              case 'o': uiFeatures |= ((uint8_t) FEATURE_NEXTOS   ); break;
-              case 'v': uiFeatures |= ((uint8_t) FEATURE_SYSVARS  ); break;
+              case 'r': uiFeatures |= ((uint16_t) FEATURE_REGISTERS); break;
+              case 'o': uiFeatures |= ((uint16_t) FEATURE_NEXTOS   ); break;
+              case 'v': uiFeatures |= ((uint16_t) FEATURE_SYSVARS  ); break;
+              case 'i': uiFeatures |= ((uint16_t) FEATURE_IRQLOAD  ); break;
+              case 'm': uiFeatures |= ((uint16_t) FEATURE_COPYBENCH); break;
+              case 'd': uiFeatures |= ((uint16_t) FEATURE_DMABENCH ); break;
+              case 'c': uiFeatures |= ((uint16_t) FEATURE_CPUBENCH ); break;
+              case 'w': uiFeatures |= ((uint16_t) FEATURE_CONTBENCH); break;
+              case 'f': uiFeatures |= ((uint16_t) FEATURE_VIDBENCH ); break;
+              case 'l': uiFeatures |= ((uint16_t) FEATURE_LATBENCH ); break;
+              case 's': uiFeatures |= ((uint16_t) FEATURE_SDBENCH  ); break;
+              case 'a': uiFeatures |= ((uint16_t) FEATURE_SDACCESS ); break;
+              case 'n': uiFeatures |= ((uint16_t) FEATURE_OSBENCH  ); break;
+              case 'u': uiFeatures |= ((uint16_t) FEATURE_GFXBENCH ); break;
 
               default:
                 fprintf(stderr, "unknown topic: \"%c\"\n", cTopic);
@@ -338,7 +735,7 @@ int parseArguments(int argc, char_t* argv[])
             g_tState.uiFeatures = uiFeatures;
           }
          #endif
-          DBGPRINTF("parseArgs() - features = 0x%02X:0x%02X\n", uiFeatures, g_tState.uiFeatures);
+          DBGPRINTF("parseArgs() - features = 0x%04X:0x%04X\n", uiFeatures, g_tState.uiFeatures);
 
           ++i;
         }
@@ -359,19 +756,30 @@ int parseArguments(int argc, char_t* argv[])
     ++i;
   }
 
+  if ((EOK == iReturn) && g_tState.bBinary && trigActive())
+  {
+    fprintf(stderr, "-b not possible with -g\n"); /* triggers use the history */
+    iReturn = EINVAL;
+  }
+
   if (ACTION_NONE == g_tState.eAction)
   {
     g_tState.eAction = ACTION_DUMP;
   }
 
+  if (g_tState.bCompact && (FEATURE_DEFAULT == g_tState.uiFeatures))
+  {
+    g_tState.uiFeatures = FEATURE_REGISTERS; /* one screen */
+  }
+
   return iReturn;
 }
 
 
 /*----------------------------------------------------------------------------*/
-/* dumpSystemInfo()                                                           */
+/* openDumpFile()                                                             */
 /*----------------------------------------------------------------------------*/
-int dumpSystemInfo(void)
+int openDumpFile(const char_t* acExt)
 {
   int iReturn = EOK;
 
@@ -391,9 +799,10 @@ int dumpSystemInfo(void)
         while (uiIdx < 0xFFFF)
         {
           snprintf(acPathName, sizeof(acPathName),
-                  "%s" ESX_DIR_SEP APP_INTERNALNAME_STR "-%u.txt",
+                  "%s" ESX_DIR_SEP APP_INTERNALNAME_STR "-%u.%s",
                   g_tState.dump.acPathName,
-                  uiIdx);
+                  uiIdx,
+                  acExt);
 
           if (INV_FILE_HND == (g_tState.dump.hFile = esx_f_open(acPathName, ESXDOS_MODE_R | ESXDOS_MODE_OE)))
           {
@@ -446,13 +855,58 @@ int dumpSystemInfo(void)
     }
   }
 
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* closeDumpFile()                                                            */
+/*----------------------------------------------------------------------------*/
+void closeDumpFile(void)
+{
+  if (INV_FILE_HND != g_tState.dump.hFile)
+  {
+    esx_f_close(g_tState.dump.hFile);
+    g_tState.dump.hFile = INV_FILE_HND; 
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* dumpSystemInfo()                                                           */
+/*----------------------------------------------------------------------------*/
+int dumpSystemInfo(void)
+{
+  int iReturn = EOK;
+
+  if (g_tState.bBinary)
+  {
+    /* Binary capture to the file; the text is shown on the screen only */
+    if (EOK == (iReturn = openDumpFile("bin")))
+    {
+      iReturn = histSave();
+    }
+    closeDumpFile();
+  }
+  else
+  {
+    iReturn = openDumpFile("txt");
+  }
+
   if (EOK == iReturn)
   {
-    DBGPRINTF("dumpSysInfo() - features = 0x%02X\n", g_tState.uiFeatures);
+    DBGPRINTF("dumpSysInfo() - features = 0x%04X\n", g_tState.uiFeatures);
 
     if (g_tState.uiFeatures & FEATURE_REGISTERS)
     {
-      dumpRegisters();
+      if (g_tState.bCompact)
+      {
+        dumpRegisterMatrix();
+      }
+      else
+      {
+        dumpRegisters();
+      }
     }
 
     if (g_tState.uiFeatures & FEATURE_SYSVARS)
@@ -464,6 +918,61 @@ int dumpSystemInfo(void)
     {
       dumpOperatingSystem();
     }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_IRQLOAD))
+    {
+      iReturn = dumpInterruptLoad(g_tState.uiIrqSeconds);
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_COPYBENCH))
+    {
+      iReturn = dumpCopyBench();
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_DMABENCH))
+    {
+      iReturn = dumpDmaBench();
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_CPUBENCH))
+    {
+      iReturn = dumpCpuBench();
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_CONTBENCH))
+    {
+      iReturn = dumpContentionBench();
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_VIDBENCH))
+    {
+      iReturn = dumpVideoBench();
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_LATBENCH))
+    {
+      iReturn = dumpLatencyBench();
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_SDBENCH))
+    {
+      iReturn = dumpSdBench(g_tState.cBenchDrive);
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_SDACCESS))
+    {
+      iReturn = dumpSdLatencyBench(g_tState.cBenchDrive);
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_OSBENCH))
+    {
+      iReturn = dumpOsBench();
+    }
+
+    if ((EOK == iReturn) && (g_tState.uiFeatures & FEATURE_GFXBENCH))
+    {
+      iReturn = dumpGfxBench();
+    }
   }
 
   if (EOK == iReturn)
@@ -471,11 +980,7 @@ int dumpSystemInfo(void)
     zheader("%s (version " APP_VERSION_STR ")", strupr(APP_INTERNALNAME_STR));
   }
 
-  if (INV_FILE_HND != g_tState.dump.hFile)
-  {
-    esx_f_close(g_tState.dump.hFile);
-    g_tState.dump.hFile = INV_FILE_HND; 
-  }
+  closeDumpFile();
 
   return iReturn;
 }
@@ -492,11 +997,46 @@ int showHelp(void)
 
   printf("%s\n\n", APP_DESCRIPTION_STR);
 
-  printf("%s file [-t rvo][-f][-q][-h][-v]\n\n", acAppName);
+  printf("%s file [-t rvoimdcwflsanu][-s][-k][-l][-x]\n", acAppName);
+  printf("     [--release][-b][-c][-D d]\n");
+  printf("     [-d f][-a f][-w [n]][-i n]\n");
+  printf("     [-p [n]][-r l:r][-g e]\n");
+  printf("     [-B n[:r[:a,l]]][-n][-o]\n");
+  printf("     [-L [n]][-f][-q][-h][-v]\n\n");
   //      0.........1.........2.........3.
   printf(" file        name of logfile\n");
   printf(" -t[opic]    topics to show:\n");
   printf("             r[eg] v[ar] o[s]\n");
+  printf("             i[rq] m[em] d[ma]\n");
+  printf("             c[pu] w[ait] f[ps]\n");
+  printf("             l[atency] s[d]\n");
+  printf("             a[ccess] n[os]\n");
+  printf("             u[pload]\n");
+  printf(" -i n        irq window 1-60 s\n");
+  printf(" -s[tore]    store in driver\n");
+  printf(" -k[eep]     append to history\n");
+  printf(" -l[ist]     show history\n");
+  printf(" -x|--flush  history to file\n");
+  printf(" --release   free history page\n");
+  printf(" -b[inary]   save raw capture\n");
+  printf(" -c[ompact]  nregs as hex grid\n");
+  printf(" -d[iff] f   changes since f\n");
+  printf(" -a[pply] f  restore from f\n");
+  printf(" -w[atch] n  log changes every\n");
+  printf("             n frames (BREAK)\n");
+  printf(" -p[anel] n  live dashboard\n");
+  printf(" -r l:r      sample nregs r\n");
+  printf("             at scanlines l\n");
+  printf(" -g e        watch and capture\n");
+  printf("             once e is true\n");
+  printf(" -B n:r:a,l  log in background\n");
+  printf("             every n frames\n");
+  printf(" -n[mi]      arm/keep snapshot\n");
+  printf(" -o          show I/O trap log\n");
+  printf(" -o 0        disarm I/O traps\n");
+  printf(" -L[ogic] n  GPIO to .vcd file\n");
+  printf("             for n frames\n");
+  printf(" -D[rive] d  drive of SD bench\n");
   printf(" -f[orce]    force overwrite\n");
   printf(" -q[uiet]    no screen output\n");
   printf(" -h[elp]     print this help\n");
@@ -554,6 +1094,17 @@ int zprintf(const char_t* acFmt, ...)
 
   uiLen = strnlen(g_tState.dump.acBuffer, sizeof(g_tState.dump.acBuffer));
 
+  if (0 != g_tState.dump.acSink)
+  {
+    if ((g_tState.dump.uiSinkLen + uiLen) < g_tState.dump.uiSinkSize)
+    {
+      memcpy(g_tState.dump.acSink + g_tState.dump.uiSinkLen, g_tState.dump.acBuffer, uiLen + 1);
+      g_tState.dump.uiSinkLen += uiLen;
+    }
+
+    return iReturn;
+  }
+
   if (!g_tState.bQuiet)
   {
     (void) printf(g_tState.dump.acBuffer);
@@ -571,6 +1122,51 @@ int zprintf(const char_t* acFmt, ...)
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* zwrite()                                                                   */
+/*----------------------------------------------------------------------------*/
+void zwrite(const char_t* acText, uint16_t uiLen)
+{
+  if (0 != g_tState.dump.acSink)
+  {
+    if ((g_tState.dump.uiSinkLen + uiLen) < g_tState.dump.uiSinkSize)
+    {
+      memcpy(g_tState.dump.acSink + g_tState.dump.uiSinkLen, acText, uiLen);
+      g_tState.dump.uiSinkLen += uiLen;
+      g_tState.dump.acSink[g_tState.dump.uiSinkLen] = '\0';
+    }
+
+    return;
+  }
+
+  if (!g_tState.bQuiet)
+  {
+    (void) fputs(acText, stdout);
+  }
+
+  if (INV_FILE_HND != g_tState.dump.hFile)
+  {
+    (void) esx_f_write(g_tState.dump.hFile, acText, uiLen);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* zsink()                                                                    */
+/*----------------------------------------------------------------------------*/
+void zsink(char_t* acBuffer, uint16_t uiSize)
+{
+  g_tState.dump.acSink     = acBuffer;
+  g_tState.dump.uiSinkSize = uiSize;
+  g_tState.dump.uiSinkLen  = 0;
+
+  if (0 != acBuffer)
+  {
+    acBuffer[0] = '\0';
+  }
+}
+
+
 /*----------------------------------------------------------------------------*/
 /* zheader()                                                                  */
 /*----------------------------------------------------------------------------*/
@@ -621,6 +1217,42 @@ uint8_t _cpuspeed(void)
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* _setcpuspeed()                                                             */
+/*----------------------------------------------------------------------------*/
+void _setcpuspeed(uint8_t uiSpeed)
+{
+  g_tState.uiCpuSpeed = uiSpeed;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* _screencols()                                                              */
+/*----------------------------------------------------------------------------*/
+uint8_t _screencols(void)
+{
+  return g_tState.tScreen.cols;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* _quiet()                                                                   */
+/*----------------------------------------------------------------------------*/
+bool _quiet(void)
+{
+  return g_tState.bQuiet;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* _dumpfile()                                                                */
+/*----------------------------------------------------------------------------*/
+uint8_t _dumpfile(void)
+{
+  return g_tState.dump.hFile;
+}
+
+
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,145 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: page.c                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+#include <intrinsic.h>
+
+#include "sysinfo.h"
+#include "page.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Page that was mapped in slot PAGE_MMU_SLOT before "pageMap" was called
+*/
+static uint8_t g_uiSavedPage = PAGE_INVALID;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* pageAlloc()                                                                */
+/*----------------------------------------------------------------------------*/
+uint8_t pageAlloc(void)
+{
+  uint8_t uiPage = esx_ide_bank_alloc(ESX_BANKTYPE_RAM);
+
+  DBGPRINTF("pageAlloc() - page = %u\n", uiPage);
+
+  return (0 != uiPage ? uiPage : PAGE_INVALID);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* pageFree()                                                                 */
+/*----------------------------------------------------------------------------*/
+void pageFree(uint8_t uiPage)
+{
+  if (PAGE_INVALID != uiPage)
+  {
+    (void) esx_ide_bank_free(ESX_BANKTYPE_RAM, uiPage);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* pageMap()                                                                  */
+/*----------------------------------------------------------------------------*/
+void* pageMap(uint8_t uiPage)
+{
+  intrinsic_di();
+
+  g_uiSavedPage = ZXN_READ_MMU3();
+  ZXN_WRITE_MMU3(uiPage);
+
+  return PAGE_ADDRESS;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* pageUnmap()                                                                */
+/*----------------------------------------------------------------------------*/
+void pageUnmap(void)
+{
+  if (PAGE_INVALID != g_uiSavedPage)
+  {
+    ZXN_WRITE_MMU3(g_uiSavedPage);
+    g_uiSavedPage = PAGE_INVALID;
+  }
+
+  intrinsic_ei();
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
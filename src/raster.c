@@ -0,0 +1,414 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: raster.c                                                           |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "dumpRegs.h"
+#include "page.h"
+#include "raster.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Configuration and results of the profiler
+*/
+static struct _raster
+{
+  /*!
+  Scanlines to sample (ascending order)
+  */
+  uint16_t auiLines[RASTER_LINES_MAX];
+  uint8_t  uiLineCount;
+
+  /*!
+  Nregs to sample at each scanline
+  */
+  uint8_t auiRegs[RASTER_REGS_MAX];
+  uint8_t uiRegCount;
+
+  /*!
+  Number of sampled frames
+  */
+  uint8_t uiFrames;
+
+  /*!
+  Histogram of a single scanline and nreg
+  */
+  uint8_t auiCount[0x100];
+
+  /*!
+  Most frequent values (and their number) of each scanline and nreg
+  */
+  struct
+  {
+    uint8_t uiValue;
+    uint8_t uiCount;
+  } tTop[RASTER_LINES_MAX][RASTER_REGS_MAX][RASTER_TOP_MAX];
+} g_tRaster =
+{
+  {0}, 0,
+  {0x16, 0x17, 0x26, 0x27, 0x32, 0x33, 0x4A, 0x68}, 8, /* default: scrolling */
+  0
+};
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Wait until the video output reaches a scanline
+@param uiLine Number of the scanline
+@return "false" = the scanline wasn't reached (timeout)
+*/
+static bool rasterWait(uint16_t uiLine);
+
+/*!
+Build the list of the most frequent values of a scanline and nreg from the
+samples in the mapped page
+@param pSamples Samples in the mapped page
+@param uiLine   Index of the scanline
+@param uiReg    Index of the nreg
+*/
+static void rasterHistogram(const uint8_t* pSamples, uint8_t uiLine, uint8_t uiReg);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* rasterParse()                                                              */
+/*----------------------------------------------------------------------------*/
+int rasterParse(const char_t* acArg)
+{
+  int iReturn = EOK;
+  char_t* pEnd = (char_t*) acArg;
+  char_t* pStart;
+  uint32_t uiValue;
+  uint16_t uiLine;
+
+  g_tRaster.uiLineCount = 0;
+
+  /* Scanlines (decimal, sorted, without duplicates) */
+  while ((EOK == iReturn) && (':' != *pEnd) && ('\0' != *pEnd))
+  {
+    pStart  = pEnd;
+    uiValue = strtoul(pStart, &pEnd, 10);
+    uiLine  = (uint16_t) uiValue;
+
+    if ((pStart == pEnd) || ((',' != *pEnd) && (':' != *pEnd) && ('\0' != *pEnd)))
+    {
+      iReturn = EINVAL; /* not a number */
+    }
+    else if ((RASTER_LINES_MAX <= g_tRaster.uiLineCount) || (0x1FF < uiValue))
+    {
+      iReturn = ERANGE;
+    }
+    else
+    {
+      uint8_t i = g_tRaster.uiLineCount;
+
+      while ((0 < i) && (g_tRaster.auiLines[i - 1] > uiLine))
+      {
+        g_tRaster.auiLines[i] = g_tRaster.auiLines[i - 1];
+        --i;
+      }
+
+      if ((0 == i) || (g_tRaster.auiLines[i - 1] != uiLine))
+      {
+        g_tRaster.auiLines[i] = uiLine;
+        ++g_tRaster.uiLineCount;
+      }
+      else
+      {
+        memmove(&g_tRaster.auiLines[i], &g_tRaster.auiLines[i + 1], (g_tRaster.uiLineCount - i) * sizeof(uint16_t));
+      }
+    }
+
+    if (',' == *pEnd)
+    {
+      ++pEnd;
+    }
+  }
+
+  /* Nregs (hexadecimal) */
+  if ((EOK == iReturn) && (':' == *pEnd))
+  {
+    g_tRaster.uiRegCount = 0;
+    ++pEnd;
+
+    while ((EOK == iReturn) && ('\0' != *pEnd))
+    {
+      pStart  = pEnd;
+      uiValue = strtoul(pStart, &pEnd, 16);
+
+      if ((pStart == pEnd) || ((',' != *pEnd) && ('\0' != *pEnd)))
+      {
+        iReturn = EINVAL; /* not a number */
+      }
+      else if ((RASTER_REGS_MAX <= g_tRaster.uiRegCount) || (0xFF < uiValue))
+      {
+        iReturn = ERANGE;
+      }
+      else
+      {
+        g_tRaster.auiRegs[g_tRaster.uiRegCount++] = (uint8_t) uiValue;
+      }
+
+      if (',' == *pEnd)
+      {
+        ++pEnd;
+      }
+    }
+  }
+
+  if ((EOK == iReturn) && ((0 == g_tRaster.uiLineCount) || (0 == g_tRaster.uiRegCount)))
+  {
+    iReturn = EINVAL;
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* rasterProfile()                                                            */
+/*----------------------------------------------------------------------------*/
+int rasterProfile(void)
+{
+  int iReturn = EOK;
+  uint8_t uiPage;
+  uint8_t* pSamples;
+  uint8_t* pSample;
+  uint16_t uiFrames;
+
+  if (PAGE_INVALID == (uiPage = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  uiFrames = PAGE_SIZE / (g_tRaster.uiLineCount * g_tRaster.uiRegCount);
+  g_tRaster.uiFrames = (uint8_t) (RASTER_FRAMES_MAX < uiFrames ? RASTER_FRAMES_MAX : uiFrames);
+
+  /*
+  The page is mapped with interrupts disabled, so nothing disturbs the timing.
+  For each frame the scanlines are awaited in ascending order and all nregs
+  are read as soon as the video output reaches the line.
+  */
+  pSamples = pSample = pageMap(uiPage);
+
+  for (uint8_t uiFrame = 0; (EOK == iReturn) && (uiFrame < g_tRaster.uiFrames); ++uiFrame)
+  {
+    for (uint8_t i = 0; i < g_tRaster.uiLineCount; ++i)
+    {
+      if (!rasterWait(g_tRaster.auiLines[i]))
+      {
+        iReturn = ERANGE; /* Error: Line isn't reached in this video mode */
+        break;
+      }
+
+      for (uint8_t j = 0; j < g_tRaster.uiRegCount; ++j)
+      {
+        *pSample++ = ZXN_READ_REG(g_tRaster.auiRegs[j]);
+      }
+    }
+  }
+
+  if (EOK == iReturn)
+  {
+    for (uint8_t i = 0; i < g_tRaster.uiLineCount; ++i)
+    {
+      for (uint8_t j = 0; j < g_tRaster.uiRegCount; ++j)
+      {
+        rasterHistogram(pSamples, i, j);
+      }
+    }
+  }
+
+  pageUnmap();
+  pageFree(uiPage);
+
+  if (EOK != iReturn)
+  {
+    return iReturn;
+  }
+
+  /* Output */
+  zheader("RASTER PROFILE (%u FRAMES)", g_tRaster.uiFrames);
+
+  for (uint8_t i = 0; i < g_tRaster.uiLineCount; ++i)
+  {
+    zprintf("LINE %u\n", g_tRaster.auiLines[i]);
+
+    for (uint8_t j = 0; j < g_tRaster.uiRegCount; ++j)
+    {
+      uint8_t uiRest = g_tRaster.uiFrames;
+
+      zprintf(" " DUMP_REGNUM ":", g_tRaster.auiRegs[j]);
+
+      for (uint8_t k = 0; (k < RASTER_TOP_MAX) && (0 != g_tRaster.tTop[i][j][k].uiCount); ++k)
+      {
+        zprintf(" %02X*%u", g_tRaster.tTop[i][j][k].uiValue, g_tRaster.tTop[i][j][k].uiCount);
+        uiRest -= g_tRaster.tTop[i][j][k].uiCount;
+      }
+
+      if (0 != uiRest)
+      {
+        zprintf(" ..*%u", uiRest);
+      }
+
+      zprintf("\n");
+    }
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* rasterLine()                                                               */
+/*----------------------------------------------------------------------------*/
+uint16_t rasterLine(void)
+{
+  uint8_t uiMsb;
+  uint8_t uiLsb;
+
+  do
+  {
+    uiMsb = ZXN_READ_REG(0x1E); /* ACTVIDLINEH */
+    uiLsb = ZXN_READ_REG(0x1F); /* ACTVIDLINEL */
+  }
+  while (uiMsb != ZXN_READ_REG(0x1E));
+
+  return (((uint16_t) (uiMsb & 0x01)) << 8) | uiLsb;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* rasterWait()                                                               */
+/*----------------------------------------------------------------------------*/
+static bool rasterWait(uint16_t uiLine)
+{
+  uint16_t uiTimeout = 0xFFFF; /* much longer than a frame at 28 MHz */
+
+  while (rasterLine() != uiLine)
+  {
+    if (0 == --uiTimeout)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* rasterHistogram()                                                          */
+/*----------------------------------------------------------------------------*/
+static void rasterHistogram(const uint8_t* pSamples, uint8_t uiLine, uint8_t uiReg)
+{
+  const uint8_t uiStride = g_tRaster.uiLineCount * g_tRaster.uiRegCount;
+  const uint8_t* pSample = pSamples + (uiLine * g_tRaster.uiRegCount) + uiReg;
+
+  memset(g_tRaster.auiCount, 0, sizeof(g_tRaster.auiCount));
+  memset(g_tRaster.tTop[uiLine][uiReg], 0, sizeof(g_tRaster.tTop[uiLine][uiReg]));
+
+  for (uint8_t uiFrame = 0; uiFrame < g_tRaster.uiFrames; ++uiFrame)
+  {
+    ++g_tRaster.auiCount[*pSample];
+    pSample += uiStride;
+  }
+
+  /* Insert each value into the sorted list of the most frequent values */
+  for (uint16_t uiValue = 0; uiValue < 0x100; ++uiValue)
+  {
+    const uint8_t uiCount = g_tRaster.auiCount[uiValue];
+    uint8_t k = RASTER_TOP_MAX;
+
+    while ((0 < k) && (g_tRaster.tTop[uiLine][uiReg][k - 1].uiCount < uiCount))
+    {
+      if (RASTER_TOP_MAX > k)
+      {
+        g_tRaster.tTop[uiLine][uiReg][k] = g_tRaster.tTop[uiLine][uiReg][k - 1];
+      }
+      --k;
+    }
+
+    if (RASTER_TOP_MAX > k)
+    {
+      g_tRaster.tTop[uiLine][uiReg][k].uiValue = (uint8_t) uiValue;
+      g_tRaster.tTop[uiLine][uiReg][k].uiCount = uiCount;
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,177 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: snap.c                                                             |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "dumpRegs.h"
+#include "capture.h"
+#include "history.h"
+#include "page.h"
+#include "sysDrv.h"
+#include "snap.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Snapshot converted to a raw capture (too big for the stack)
+*/
+static capture_t g_tSnap;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* snapArm()                                                                  */
+/*----------------------------------------------------------------------------*/
+int snapArm(void)
+{
+  int iReturn = EOK;
+  uint16_t uiPageValue;
+  uint8_t uiPage = PAGE_INVALID;
+  snapshot_t* pSnap;
+  bool bTaken = false;
+  uint16_t uiPC = 0;
+  uint16_t uiSP = 0;
+
+  if (!sysDrvPresent())
+  {
+    fprintf(stderr, "driver not installed (.install sysinfo.drv)\n");
+    return ENOTSUP;
+  }
+
+  zheader("NMI SNAPSHOT");
+
+  if ((EOK == sysDrvGet(SYSDRV_FIELD_SNAPPAGE, &uiPageValue)) && (0 != uiPageValue))
+  {
+    uiPage = (uint8_t) uiPageValue;
+  }
+  else if (PAGE_INVALID == (uiPage = pageAlloc()))
+  {
+    return ENOMEM;
+  }
+
+  pSnap = (snapshot_t*) pageMap(uiPage);
+
+  /* Convert a snapshot that was taken into a raw capture */
+  if ((0 == memcmp(pSnap->acMagic, SNAP_MAGIC, sizeof(pSnap->acMagic))) && pSnap->uiValid)
+  {
+    memset(&g_tSnap, 0, sizeof(g_tSnap));
+    memcpy(g_tSnap.auiFrames, pSnap->auiFrames, sizeof(g_tSnap.auiFrames));
+    memcpy(g_tSnap.auiRegs, pSnap->auiRegs, sizeof(g_tSnap.auiRegs));
+    memcpy(g_tSnap.auiVars, pSnap->auiVars, sizeof(g_tSnap.auiVars));
+    g_tSnap.uiRegCount = pSnap->uiRegCount;
+
+    uiPC   = pSnap->uiPC;
+    uiSP   = pSnap->uiSP;
+    bTaken = true;
+  }
+
+  /* Arm: list of all nregs in the order of "g_tRegisters" */
+  memset(pSnap, 0, sizeof(snapshot_t));
+  memcpy(pSnap->acMagic, SNAP_MAGIC, sizeof(pSnap->acMagic));
+  pSnap->uiVersion = SNAP_VERSION;
+
+  while ((0 != g_tRegisters[pSnap->uiRegCount].acName) && (CAPTURE_REGS_MAX > pSnap->uiRegCount))
+  {
+    pSnap->auiList[pSnap->uiRegCount] = g_tRegisters[pSnap->uiRegCount].uiNumber;
+    ++pSnap->uiRegCount;
+  }
+
+  pageUnmap();
+
+  (void) sysDrvSet(SYSDRV_FIELD_SNAPPAGE, uiPage);
+
+  if (bTaken)
+  {
+    zprintf("PC = 0x%04X  SP = 0x%04X\n", uiPC, uiSP);
+    zprintf("FRAMES = %lu\n", captureFrames(&g_tSnap));
+
+    /* Keep it in the history, so it can be listed, flushed and compared */
+    captureStamp(&g_tSnap);
+    iReturn = histStore(&g_tSnap);
+  }
+  else
+  {
+    zprintf("no snapshot taken yet\n");
+  }
+
+  zprintf("armed (page %u)\n", uiPage);
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
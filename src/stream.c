@@ -0,0 +1,260 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: stream.c                                                           |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+
+#include "sysinfo.h"
+#include "capture.h"
+#include "stream.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Size of the raw data of a capture that is encoded (nregs, sysvars, clips)
+*/
+#define STREAM_DATA_MAX (CAPTURE_REGS_MAX + CAPTURE_VARS_SIZE + sizeof(((capture_t*) 0)->auiClip))
+
+/*!
+Worst case size of an encoded record (alternating literals and zeros need
+three bytes for two bytes of data)
+*/
+#define STREAM_CODE_MAX (sizeof(streamrec_t) + ((STREAM_DATA_MAX * 3) / 2) + 3)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+State of the stream (too big for the stack)
+*/
+static struct _stream
+{
+  /*!
+  Number of records since the last keyframe
+  */
+  uint8_t uiSinceKey;
+
+  /*!
+  Number of bytes written
+  */
+  uint32_t uiSize;
+
+  /*!
+  Encoded record
+  */
+  uint8_t auiCode[STREAM_CODE_MAX];
+} g_tStream;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Encode a block of a capture (XOR a reference) into the code buffer
+@param pCode Current position in the code buffer
+@param pData Data of the current capture
+@param pRef  Data of the reference (0 = keyframe)
+@param uiLen Number of bytes
+@return New position in the code buffer
+*/
+static uint8_t* streamEncode(uint8_t* pCode, const uint8_t* pData, const uint8_t* pRef, uint16_t uiLen);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* streamBegin()                                                              */
+/*----------------------------------------------------------------------------*/
+int streamBegin(const capture_t* pCapture)
+{
+  streamhdr_t tHeader;
+
+  memcpy(tHeader.acMagic, STREAM_MAGIC, sizeof(tHeader.acMagic));
+  tHeader.uiVersion  = STREAM_VERSION;
+  tHeader.uiRegCount = pCapture->uiRegCount;
+  tHeader.uiVarSize  = CAPTURE_VARS_SIZE;
+  tHeader.uiClipSize = sizeof(pCapture->auiClip);
+  tHeader.uiKeyRate  = STREAM_KEY_RATE;
+
+  g_tStream.uiSinceKey = 0;
+  g_tStream.uiSize     = sizeof(tHeader);
+
+  if (sizeof(tHeader) != esx_f_write(_dumpfile(), &tHeader, sizeof(tHeader)))
+  {
+    return EACCES;
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* streamWrite()                                                              */
+/*----------------------------------------------------------------------------*/
+int streamWrite(const capture_t* pPrev, const capture_t* pCurr)
+{
+  streamrec_t* pRec = (streamrec_t*) &g_tStream.auiCode[0];
+  uint8_t* pCode = (uint8_t*) (pRec + 1);
+  uint16_t uiLen;
+
+  if (0 == g_tStream.uiSinceKey)
+  {
+    pRec->uiType = STREAM_KEYFRAME;
+    pPrev = 0;
+  }
+  else
+  {
+    pRec->uiType = STREAM_DELTA;
+  }
+
+  if (STREAM_KEY_RATE <= ++g_tStream.uiSinceKey)
+  {
+    g_tStream.uiSinceKey = 0;
+  }
+
+  memcpy(pRec->auiFrames, pCurr->auiFrames, sizeof(pRec->auiFrames));
+
+  pCode = streamEncode(pCode, pCurr->auiRegs, (pPrev ? pPrev->auiRegs : 0), pCurr->uiRegCount);
+  pCode = streamEncode(pCode, pCurr->auiVars, (pPrev ? pPrev->auiVars : 0), CAPTURE_VARS_SIZE);
+  pCode = streamEncode(pCode, &pCurr->auiClip[0][0], (pPrev ? &pPrev->auiClip[0][0] : 0), sizeof(pCurr->auiClip));
+
+  uiLen = (uint16_t) (pCode - &g_tStream.auiCode[0]);
+  pRec->uiLen = uiLen - sizeof(streamrec_t);
+
+  g_tStream.uiSize += uiLen;
+
+  /* One write per record */
+  if (uiLen != esx_f_write(_dumpfile(), g_tStream.auiCode, uiLen))
+  {
+    return EACCES;
+  }
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* streamSize()                                                               */
+/*----------------------------------------------------------------------------*/
+uint32_t streamSize(void)
+{
+  return g_tStream.uiSize;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* streamEncode()                                                             */
+/*----------------------------------------------------------------------------*/
+static uint8_t* streamEncode(uint8_t* pCode, const uint8_t* pData, const uint8_t* pRef, uint16_t uiLen)
+{
+  uint8_t* pToken = 0; /* token of the current run of literals */
+  uint8_t uiValue;
+
+  /*
+  REMARK: Each block is encoded on its own, so runs don't span the blocks.
+          This costs at most two tokens per record ...
+  */
+  while (0 != uiLen)
+  {
+    uiValue = *pData++ ^ (pRef ? *pRef++ : 0);
+    --uiLen;
+
+    if (0 == uiValue)
+    {
+      uint8_t uiRun = 1;
+
+      while ((0 != uiLen) && (128 > uiRun) && (0 == (*pData ^ (pRef ? *pRef : 0))))
+      {
+        ++pData;
+        pRef = (pRef ? pRef + 1 : 0);
+        --uiLen;
+        ++uiRun;
+      }
+
+      *pCode++ = 0x80 | (uiRun - 1);
+      pToken = 0;
+    }
+    else
+    {
+      if ((0 == pToken) || (0x7F == *pToken))
+      {
+        pToken = pCode++;
+        *pToken = 0x00;
+      }
+      else
+      {
+        ++(*pToken);
+      }
+
+      *pCode++ = uiValue;
+    }
+  }
+
+  return pCode;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,215 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: sysDrv.c                                                           |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include <arch/zxn/esxdos.h>
+#include <arch/zxn/sysvar.h>
+
+#include "sysinfo.h"
+#include "dumpDos.h"
+#include "sysDrv.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Names of all cached fields (index = sysdrvfield_t)
+*/
+static const char_t* g_acFieldNames[SYSDRV_FIELD_MAX] =
+{
+  "MACHINEID",
+  "BOARDID",
+  "COREVERSION",
+  "RAMSIZE",
+  "DRIVES",
+  "DOSVERSION",
+  "HISTPAGE",
+  "BGPAGE",
+  "BGRATE",
+  "BGNEXT",
+  "BGCOUNT",
+  "SNAPPAGE",
+  "TRAPPAGE"
+};
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Call the API of the resident driver (M_DRVAPI)
+@param uiCall Number of the driver call (B)
+@param pApi   Parameters (DE, HL) and results (BC, DE, HL)
+@return EOK = "no error"
+*/
+static int sysDrvCall(uint8_t uiCall, struct esx_drvapi* pApi);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* sysDrvCall()                                                               */
+/*----------------------------------------------------------------------------*/
+static int sysDrvCall(uint8_t uiCall, struct esx_drvapi* pApi)
+{
+  pApi->call.driver   = SYSDRV_ID;
+  pApi->call.function = uiCall;
+
+  return (0 == esx_m_drvapi(pApi) ? EOK : ENOTSUP);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* sysDrvPresent()                                                            */
+/*----------------------------------------------------------------------------*/
+bool sysDrvPresent(void)
+{
+  struct esx_drvapi tApi;
+  memset(&tApi, 0, sizeof(tApi));
+
+  return (EOK == sysDrvCall(SYSDRV_CALL_STATUS, &tApi));
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* sysDrvGet()                                                                */
+/*----------------------------------------------------------------------------*/
+int sysDrvGet(uint8_t eField, uint16_t* pValue)
+{
+  int iReturn = EOK;
+  struct esx_drvapi tApi;
+
+  memset(&tApi, 0, sizeof(tApi));
+  tApi.de = eField;
+
+  if (EOK == (iReturn = sysDrvCall(SYSDRV_CALL_GET, &tApi)))
+  {
+    *pValue = tApi.de;
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* sysDrvSet()                                                                */
+/*----------------------------------------------------------------------------*/
+int sysDrvSet(uint8_t eField, uint16_t uiValue)
+{
+  struct esx_drvapi tApi;
+
+  memset(&tApi, 0, sizeof(tApi));
+  tApi.de = eField;
+  tApi.hl = uiValue;
+
+  return sysDrvCall(SYSDRV_CALL_SET, &tApi);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* sysDrvStore()                                                              */
+/*----------------------------------------------------------------------------*/
+int sysDrvStore(void)
+{
+  int iReturn = EOK;
+  uint16_t auiValues[SYSDRV_FIELD_STATIC];
+
+  zheader("RESIDENT DRIVER");
+
+  if (!sysDrvPresent())
+  {
+    fprintf(stderr, "driver not installed (.install sysinfo.drv)\n");
+    iReturn = ENOTSUP;
+  }
+
+  if (EOK == iReturn)
+  {
+    auiValues[SYSDRV_FIELD_MACHINEID]   = ZXN_READ_REG(0x00);
+    auiValues[SYSDRV_FIELD_BOARDID]     = ZXN_READ_REG(0x0F);
+    auiValues[SYSDRV_FIELD_COREVERSION] = (((uint16_t) ZXN_READ_REG(0x01)) << 8) | ZXN_READ_REG(0x0E);
+    auiValues[SYSDRV_FIELD_RAMSIZE]     = ((uint16_t) ((uint8_t*) 0x5B69)[0]) + 1; /* MAXBNK */
+    auiValues[SYSDRV_FIELD_DRIVES]      = getAvailableDrives();
+    auiValues[SYSDRV_FIELD_DOSVERSION]  = esx_m_dosversion();
+
+    for (uint8_t i = 0; i < SYSDRV_FIELD_STATIC; ++i)
+    {
+      if (EOK != (iReturn = sysDrvSet(i, auiValues[i])))
+      {
+        break;
+      }
+
+      zprintf(DUMP_DRVNAME " = 0x%04X\n", g_acFieldNames[i], auiValues[i]);
+    }
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
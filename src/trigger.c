@@ -0,0 +1,450 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: trigger.c                                                          |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "dumpRegs.h"
+#include "dumpVars.h"
+#include "capture.h"
+#include "trigger.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Maximum length of a name in an expression
+*/
+#define TRIG_NAME_MAX (0x10)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Compiler state and compiled predicate
+*/
+static struct _trigger
+{
+  /*!
+  Compiled predicate (TRIG_OP_...)
+  */
+  uint8_t auiCode[TRIG_CODE_MAX];
+
+  /*!
+  Length of the compiled predicate (0 = "no trigger")
+  */
+  uint8_t uiLen;
+
+  /*!
+  Current position in the expression while compiling
+  */
+  const char_t* pExpr;
+
+  /*!
+  Result of the compilation
+  */
+  int iError;
+} g_tTrigger;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Append a byte to the compiled predicate
+@param uiByte Byte to append
+*/
+static void trigEmit(uint8_t uiByte);
+
+/*!
+Skip whitespaces and check if the expression continues with a token
+@param acToken Token to check (it is consumed if found)
+@return "true" = token found
+*/
+static bool trigAccept(const char_t* acToken);
+
+/*!
+Compile: operand := name | number
+*/
+static void trigOperand(void);
+
+/*!
+Compile: term := operand ['&' operand]
+*/
+static void trigTerm(void);
+
+/*!
+Compile: compare := term [('=='|'!='|'<='|'>='|'<'|'>') term]
+*/
+static void trigCompare(void);
+
+/*!
+Compile: and := compare {'&&' compare}
+*/
+static void trigAnd(void);
+
+/*!
+Compile: expression := and {'||' and}
+*/
+static void trigOr(void);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* trigCompile()                                                              */
+/*----------------------------------------------------------------------------*/
+int trigCompile(const char_t* acExpr)
+{
+  g_tTrigger.uiLen  = 0;
+  g_tTrigger.pExpr  = acExpr;
+  g_tTrigger.iError = EOK;
+
+  trigOr();
+  trigEmit(TRIG_OP_END);
+
+  while (isspace(*g_tTrigger.pExpr))
+  {
+    ++g_tTrigger.pExpr;
+  }
+
+  if ((EOK == g_tTrigger.iError) && ('\0' != *g_tTrigger.pExpr))
+  {
+    g_tTrigger.iError = EINVAL; /* Error: garbage at the end */
+  }
+
+  if (EOK != g_tTrigger.iError)
+  {
+    g_tTrigger.uiLen = 0;
+  }
+
+  return g_tTrigger.iError;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigActive()                                                               */
+/*----------------------------------------------------------------------------*/
+bool trigActive(void)
+{
+  return (0 != g_tTrigger.uiLen);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigEval()                                                                 */
+/*----------------------------------------------------------------------------*/
+bool trigEval(const capture_t* pCapture)
+{
+  uint16_t auiStack[TRIG_STACK_MAX];
+  uint16_t* pTop = &auiStack[0] - 1;
+  const uint8_t* pCode = &g_tTrigger.auiCode[0];
+  uint16_t uiValue;
+
+  /*
+  The compiler guarantees a valid sequence of operations, so there are no
+  checks of the stack here: this is called every frame ...
+  */
+  while (TRIG_OP_END != *pCode)
+  {
+    switch (*pCode++)
+    {
+      case TRIG_OP_REG:
+        *++pTop = pCapture->auiRegs[*pCode++];
+        continue;
+
+      case TRIG_OP_VAR8:
+        *++pTop = pCapture->auiVars[*((const uint16_t*) pCode)];
+        pCode += 2;
+        continue;
+
+      case TRIG_OP_VAR16:
+        *++pTop = *((const uint16_t*) &pCapture->auiVars[*((const uint16_t*) pCode)]);
+        pCode += 2;
+        continue;
+
+      case TRIG_OP_CONST:
+        *++pTop = *((const uint16_t*) pCode);
+        pCode += 2;
+        continue;
+    }
+
+    /* Binary operators */
+    uiValue = *pTop--;
+
+    switch (pCode[-1])
+    {
+      case TRIG_OP_AND:  *pTop = (*pTop &  uiValue);              break;
+      case TRIG_OP_EQ:   *pTop = (*pTop == uiValue);              break;
+      case TRIG_OP_NE:   *pTop = (*pTop != uiValue);              break;
+      case TRIG_OP_LT:   *pTop = (*pTop <  uiValue);              break;
+      case TRIG_OP_GT:   *pTop = (*pTop >  uiValue);              break;
+      case TRIG_OP_LE:   *pTop = (*pTop <= uiValue);              break;
+      case TRIG_OP_GE:   *pTop = (*pTop >= uiValue);              break;
+      case TRIG_OP_LAND: *pTop = ((0 != *pTop) && (0 != uiValue)); break;
+      case TRIG_OP_LOR:  *pTop = ((0 != *pTop) || (0 != uiValue)); break;
+    }
+  }
+
+  return (0 != *pTop);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigEmit()                                                                 */
+/*----------------------------------------------------------------------------*/
+static void trigEmit(uint8_t uiByte)
+{
+  if (TRIG_CODE_MAX > g_tTrigger.uiLen)
+  {
+    g_tTrigger.auiCode[g_tTrigger.uiLen++] = uiByte;
+  }
+  else
+  {
+    g_tTrigger.iError = ERANGE; /* Error: expression too long */
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigAccept()                                                               */
+/*----------------------------------------------------------------------------*/
+static bool trigAccept(const char_t* acToken)
+{
+  const size_t uiLen = strlen(acToken);
+
+  while (isspace(*g_tTrigger.pExpr))
+  {
+    ++g_tTrigger.pExpr;
+  }
+
+  if (0 == strncmp(g_tTrigger.pExpr, acToken, uiLen))
+  {
+    g_tTrigger.pExpr += uiLen;
+    return true;
+  }
+
+  return false;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigOperand()                                                              */
+/*----------------------------------------------------------------------------*/
+static void trigOperand(void)
+{
+  char_t acName[TRIG_NAME_MAX];
+  uint8_t uiLen = 0;
+
+  while (isspace(*g_tTrigger.pExpr))
+  {
+    ++g_tTrigger.pExpr;
+  }
+
+  if (isdigit(*g_tTrigger.pExpr)) /* number */
+  {
+    char_t* pEnd;
+    uint16_t uiValue = (uint16_t) strtoul(g_tTrigger.pExpr, &pEnd, 0);
+
+    g_tTrigger.pExpr = pEnd;
+
+    trigEmit(TRIG_OP_CONST);
+    trigEmit(uiValue & 0xFF);
+    trigEmit(uiValue >> 8);
+    return;
+  }
+
+  while ((isalnum(*g_tTrigger.pExpr) || ('_' == *g_tTrigger.pExpr)) && (uiLen < (sizeof(acName) - 1)))
+  {
+    acName[uiLen++] = *g_tTrigger.pExpr++;
+  }
+  acName[uiLen] = '\0';
+
+  if (0 != uiLen)
+  {
+    /* nreg ? */
+    for (uint8_t i = 0; 0 != g_tRegisters[i].acName; ++i)
+    {
+      if (0 == stricmp(acName, g_tRegisters[i].acName))
+      {
+        trigEmit(TRIG_OP_REG);
+        trigEmit(i);
+        return;
+      }
+    }
+
+    /* system variable ? */
+    for (const varentry_t* pVar = &g_tVariables[0]; 0 != pVar->acName; ++pVar)
+    {
+      if ((0 == stricmp(acName, pVar->acName)) && (0 != pVar->uiSize))
+      {
+        uint16_t uiOffset = pVar->uiAddress - CAPTURE_VARS_ADDR;
+
+        trigEmit(1 == pVar->uiSize ? TRIG_OP_VAR8 : TRIG_OP_VAR16);
+        trigEmit(uiOffset & 0xFF);
+        trigEmit(uiOffset >> 8);
+        return;
+      }
+    }
+  }
+
+  g_tTrigger.iError = EINVAL; /* Error: unknown name */
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigTerm()                                                                 */
+/*----------------------------------------------------------------------------*/
+static void trigTerm(void)
+{
+  trigOperand();
+
+  while (EOK == g_tTrigger.iError)
+  {
+    while (isspace(*g_tTrigger.pExpr))
+    {
+      ++g_tTrigger.pExpr;
+    }
+
+    if (('&' == g_tTrigger.pExpr[0]) && ('&' != g_tTrigger.pExpr[1]))
+    {
+      ++g_tTrigger.pExpr;
+      trigOperand();
+      trigEmit(TRIG_OP_AND);
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigCompare()                                                              */
+/*----------------------------------------------------------------------------*/
+static void trigCompare(void)
+{
+  static const struct
+  {
+    const char_t* acToken;
+    uint8_t uiOp;
+  } tOps[] =
+  {
+    {"==", TRIG_OP_EQ},
+    {"!=", TRIG_OP_NE},
+    {"<=", TRIG_OP_LE},
+    {">=", TRIG_OP_GE},
+    {"<",  TRIG_OP_LT},
+    {">",  TRIG_OP_GT}
+  };
+
+  trigTerm();
+
+  for (uint8_t i = 0; (EOK == g_tTrigger.iError) && (i < (sizeof(tOps) / sizeof(tOps[0]))); ++i)
+  {
+    if (trigAccept(tOps[i].acToken))
+    {
+      trigTerm();
+      trigEmit(tOps[i].uiOp);
+      break;
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigAnd()                                                                  */
+/*----------------------------------------------------------------------------*/
+static void trigAnd(void)
+{
+  trigCompare();
+
+  while ((EOK == g_tTrigger.iError) && trigAccept("&&"))
+  {
+    trigCompare();
+    trigEmit(TRIG_OP_LAND);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* trigOr()                                                                   */
+/*----------------------------------------------------------------------------*/
+static void trigOr(void)
+{
+  trigAnd();
+
+  while ((EOK == g_tTrigger.iError) && trigAccept("||"))
+  {
+    trigAnd();
+    trigEmit(TRIG_OP_LOR);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
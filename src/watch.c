@@ -0,0 +1,302 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: watch.c                                                            |
+| project:  ZX Spectrum Next - SYSINFO                                         |
+| author:   Stefan Zell                                                        |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Read and show system information of the ZX Spectrum Next (dot command)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <z80.h>
+#include <intrinsic.h>
+#include <arch/zxn.h>
+
+#include "sysinfo.h"
+#include "dumpRegs.h"
+#include "dumpVars.h"
+#include "capture.h"
+#include "history.h"
+#include "trigger.h"
+#include "stream.h"
+#include "watch.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Address of the system variable FRAMES (changes every frame, never logged)
+*/
+#define WATCH_FRAMES_ADDR (0x5C78)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+Two captures that are used alternately as "old" and "new" (too big for the
+stack)
+*/
+static capture_t g_tWatch[2];
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+Log all entries that differ between two captures
+@param pOld Previous capture
+@param pNew Current capture
+@return Number of logged changes
+*/
+static uint16_t watchCompare(const capture_t* pOld, const capture_t* pNew);
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* watchCapture()                                                             */
+/*----------------------------------------------------------------------------*/
+int watchCapture(uint8_t uiFrames, bool bStream)
+{
+  int iReturn = EOK;
+  uint32_t uiChanges = 0;
+  uint8_t uiOld = 0;
+
+  if (!bStream)
+  {
+    zheader("WATCHING EVERY %u FRAMES", (uiFrames ? uiFrames : 1));
+  }
+
+  captureTake(&g_tWatch[uiOld]);
+
+  if (trigActive())
+  {
+    /*
+    Only the predicate is evaluated every frame. A capture is stored in the
+    history page when the predicate becomes true (rising edge).
+    */
+    bool bLast = trigEval(&g_tWatch[uiOld]);
+    bool bNow;
+
+    while ((EOK == iReturn) && !watchBreak())
+    {
+      watchWait(uiFrames);
+
+      captureTake(&g_tWatch[0]);
+
+      if ((bNow = trigEval(&g_tWatch[0])) && !bLast)
+      {
+        zprintf(DUMP_FRAMES " ", captureFrames(&g_tWatch[0]));
+
+        captureStamp(&g_tWatch[0]);
+        iReturn = histStore(&g_tWatch[0]);
+        ++uiChanges;
+      }
+
+      bLast = bNow;
+    }
+
+    zheader("%lu TRIGGERS", uiChanges);
+  }
+  else if (bStream)
+  {
+    /*
+    Every capture is written as delta to the previous one, so the size of a
+    record depends only on the number of changes ...
+    */
+    if (EOK == (iReturn = streamBegin(&g_tWatch[uiOld])))
+    {
+      iReturn = streamWrite(0, &g_tWatch[uiOld]);
+    }
+
+    while ((EOK == iReturn) && !watchBreak())
+    {
+      watchWait(uiFrames);
+
+      captureTake(&g_tWatch[uiOld ^ 1]);
+      iReturn = streamWrite(&g_tWatch[uiOld], &g_tWatch[uiOld ^ 1]);
+      uiOld ^= 1;
+      ++uiChanges;
+    }
+
+    /* The dump file is binary here, so the summary goes to the screen only */
+    if (!_quiet())
+    {
+      printf("%lu records, %lu bytes\n", uiChanges + 1, streamSize());
+    }
+  }
+  else
+  {
+    while (!watchBreak())
+    {
+      watchWait(uiFrames);
+
+      captureTake(&g_tWatch[uiOld ^ 1]);
+      uiChanges += watchCompare(&g_tWatch[uiOld], &g_tWatch[uiOld ^ 1]);
+      uiOld ^= 1;
+    }
+
+    zheader("%lu CHANGES", uiChanges);
+  }
+
+  return iReturn;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* watchWait()                                                                */
+/*----------------------------------------------------------------------------*/
+void watchWait(uint8_t uiFrames)
+{
+  if (0 == uiFrames)
+  {
+    uiFrames = 1;
+  }
+
+  while (uiFrames--)
+  {
+    intrinsic_halt();
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* watchBreak()                                                               */
+/*----------------------------------------------------------------------------*/
+bool watchBreak(void)
+{
+  return (0 == (z80_inp(0xFEFE) & 0x01)) &&  /* CAPS SHIFT */
+         (0 == (z80_inp(0x7FFE) & 0x01));    /* SPACE      */
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* watchCompare()                                                             */
+/*----------------------------------------------------------------------------*/
+static uint16_t watchCompare(const capture_t* pOld, const capture_t* pNew)
+{
+  uint16_t uiChanges = 0;
+  const uint32_t uiFrames = captureFrames(pNew);
+
+  for (uint8_t i = 0; i < pNew->uiRegCount; ++i)
+  {
+    if (pOld->auiRegs[i] != pNew->auiRegs[i])
+    {
+      zprintf(DUMP_FRAMES " " DUMP_REGNUM "-" DUMP_REGNAME " = %02X\n", uiFrames, g_tRegisters[i].uiNumber, g_tRegisters[i].acName, pNew->auiRegs[i]);
+      ++uiChanges;
+    }
+  }
+
+  for (uint8_t i = 0; i < CAPTURE_CLIP_MAX; ++i)
+  {
+    if (0 != memcmp(pOld->auiClip[i], pNew->auiClip[i], sizeof(pNew->auiClip[i])))
+    {
+      zprintf(DUMP_FRAMES " " DUMP_REGNUM "-CLIP = %02X %02X %02X %02X\n",
+              uiFrames, 0x18 + i, pNew->auiClip[i][0], pNew->auiClip[i][1], pNew->auiClip[i][2], pNew->auiClip[i][3]);
+      ++uiChanges;
+    }
+  }
+
+  /*
+  The block of system variables is compared byte by byte first, only if there
+  are any differences the list of variables is searched ...
+  */
+  bool bVarChanged = false;
+  for (uint16_t i = 0; i < CAPTURE_VARS_SIZE; ++i)
+  {
+    if ((pOld->auiVars[i] != pNew->auiVars[i]) && (((uint16_t) (i - (WATCH_FRAMES_ADDR - CAPTURE_VARS_ADDR))) > 2))
+    {
+      bVarChanged = true;
+      break;
+    }
+  }
+
+  if (bVarChanged)
+  {
+    const varentry_t* pVar = &g_tVariables[0];
+    while (0 != pVar->acName)
+    {
+      uint16_t uiOffset = pVar->uiAddress - CAPTURE_VARS_ADDR;
+
+      if ((0 != pVar->uiSize) &&
+          (WATCH_FRAMES_ADDR != pVar->uiAddress) &&
+          (0 != memcmp(&pOld->auiVars[uiOffset], &pNew->auiVars[uiOffset], pVar->uiSize)))
+      {
+        const uint8_t* pValue = &pNew->auiVars[uiOffset];
+
+        zprintf(DUMP_FRAMES " " DUMP_VARNUM "-" DUMP_VARNAME " = ", uiFrames, pVar->uiAddress, pVar->acName);
+
+        /* Numbers (up to 4 bytes) MSB first, blocks in the order of memory */
+        for (uint8_t j = 0; j < pVar->uiSize; ++j)
+        {
+          zprintf("%02X", pValue[pVar->uiSize <= 4 ? pVar->uiSize - 1 - j : j]);
+        }
+
+        zprintf("\n");
+        ++uiChanges;
+      }
+
+      ++pVar;
+    }
+  }
+
+  return uiChanges;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/